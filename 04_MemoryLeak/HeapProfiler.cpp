@@ -0,0 +1,580 @@
+/*============================================================================
+ *  HeapProfiler.cpp - 전역 operator new/delete 교체 + 콜사이트 집계
+ *  ---------------------------------------------------------------------------
+ *  모든 할당 앞에 16바이트 헤더를 붙여서 (콜사이트 ID, 카테고리, 요청 크기)를 기록합니다.
+ *  delete 시 헤더만 보면 샘플된 할당인지 바로 알 수 있으므로
+ *  별도의 포인터 → 샘플 해시맵이 필요 없습니다.
+ *  카테고리는 MemoryBudget 집계용입니다 (할당한 스레드와 해제하는 스레드가 달라도 정확).
+ *
+ *  콜사이트 테이블은 고정 크기 정적 배열입니다.
+ *  프로파일러 내부에서 new를 호출하면 재귀가 되므로 힙을 쓰지 않습니다.
+ *
+ *  Start()로 간격을 바꿔도 이전 샘플이 새 간격으로 보정되지 않도록
+ *  콜사이트는 (콜스택, 샘플링 간격) 쌍으로 구분하고, 보정은 콜사이트의 간격으로 합니다.
+ *============================================================================*/
+#include "HeapProfiler.h"
+#include "MemoryBudget.h"
+
+#include <atomic>
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <vector>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <Windows.h>
+#include <DbgHelp.h>
+#pragma comment(lib, "DbgHelp.lib")
+#define HEAPPROF_NOINLINE __declspec(noinline)
+#else
+#include <execinfo.h>
+#define HEAPPROF_NOINLINE __attribute__((noinline))
+#endif
+
+namespace HeapProfiler {
+namespace {
+
+// ============================================================================
+// 내부 자료구조
+// ============================================================================
+const int kMaxDepth    = 32;
+const int kMaxSites    = 4096;   // 2의 거듭제곱 (해시 마스크용)
+
+// CaptureStack → RecordSample → AllocateHooked → AllocateOrThrow → operator new 까지 건너뜀
+// (다섯 함수 모두 인라인되지 않아야 맨 위 프레임이 new를 호출한 코드가 됨)
+const int kSkipFrames  = 5;
+
+struct AllocHeader {
+    uint32_t siteId;   // 0이면 샘플되지 않은 할당, 그 외 (테이블 인덱스 + 1)
+    uint16_t magic;    // kHeaderMagic. delete 시 헤더를 믿기 전에 확인
+    uint8_t  category; // MemCategory
+    uint8_t  reserved;
+    uint64_t size;     // 사용자가 요청한 크기
+};
+static_assert(sizeof(AllocHeader) == 16, "헤더가 16바이트여야 malloc 정렬이 유지됩니다");
+
+const uint16_t kHeaderMagic = 0x4850;  // 'HP'
+
+struct CallSite {
+    uint64_t hash;
+    int      depth;
+    void*    frames[kMaxDepth];
+    size_t   interval;      // 이 콜사이트의 샘플을 뽑은 평균 간격
+
+    // 샘플 원시값 (pprof heap_v2는 원시값을 받아서 스스로 보정함)
+    uint64_t liveSamples;
+    uint64_t liveSampledBytes;
+    uint64_t totalSamples;
+    uint64_t totalSampledBytes;
+};
+
+// operator new가 main 이전(정적 초기화 중)에도 불리므로
+// 생성자가 필요 없는 상수 초기화 객체만 사용합니다.
+class SpinLock {
+    std::atomic_flag m_Flag = ATOMIC_FLAG_INIT;
+public:
+    void lock()   { while (m_Flag.test_and_set(std::memory_order_acquire)) {} }
+    void unlock() { m_Flag.clear(std::memory_order_release); }
+};
+
+SpinLock              g_Lock;
+CallSite              g_Sites[kMaxSites];
+int                   g_SiteCount = 0;
+bool                  g_TableFull = false;
+uint64_t              g_SampledAllocs = 0;
+
+std::atomic<bool>     g_Running{false};
+std::atomic<size_t>   g_Interval{512 * 1024};
+Options               g_Options;
+bool                  g_ExitHookInstalled = false;
+
+thread_local int64_t  t_BytesUntilSample = 0;
+thread_local size_t   t_DrawnInterval = 0;      // t_BytesUntilSample을 뽑을 때의 간격
+thread_local bool     t_IntervalDrawn = false;
+thread_local uint64_t t_Rng = 0;
+thread_local bool     t_InProfiler = false;
+
+// 프로파일러 내부에서 발생하는 할당은 샘플링하지 않도록 막는 가드
+struct ReentryGuard {
+    bool m_Prev;
+    ReentryGuard() : m_Prev(t_InProfiler) { t_InProfiler = true; }
+    ~ReentryGuard() { t_InProfiler = m_Prev; }
+};
+
+// ============================================================================
+// 샘플 간격 (지수분포) - 할당 크기와 무관하게 바이트 단위로 균일하게 샘플링
+// ============================================================================
+uint64_t NextRandom() {
+    // xorshift64* (스레드별 시드: thread_local 변수의 주소)
+    uint64_t x = t_Rng;
+    if (x == 0) x = (uint64_t)(uintptr_t)&t_Rng ^ 0x9E3779B97F4A7C15ULL;
+    x ^= x >> 12; x ^= x << 25; x ^= x >> 27;
+    t_Rng = x;
+    return x * 0x2545F4914F6CDD1DULL;
+}
+
+int64_t NextSampleInterval() {
+    size_t interval = g_Interval.load(std::memory_order_relaxed);
+    t_DrawnInterval = interval;
+    if (interval <= 1) return 0;
+
+    // U ∈ (0, 1] → -ln(U) * interval
+    double u = (double)((NextRandom() >> 11) + 1) * (1.0 / 9007199254740992.0);
+    double next = -std::log(u) * (double)interval;
+    if (next > 1e12) next = 1e12;
+    return (int64_t)next;
+}
+
+// 샘플 → 실제 값 보정 계수 (pprof의 heap_v2 보정과 동일한 식). interval은 샘플을 뽑은 간격
+double UnsampleScale(uint64_t samples, uint64_t sampledBytes, size_t interval) {
+    if (interval <= 1 || samples == 0) return 1.0;
+    double avg = (double)sampledBytes / (double)samples;
+    return 1.0 / (1.0 - std::exp(-avg / (double)interval));
+}
+
+// ============================================================================
+// 콜스택 캡처 / 콜사이트 테이블
+// ============================================================================
+HEAPPROF_NOINLINE int CaptureStack(void** frames) {
+#ifdef _WIN32
+    return (int)RtlCaptureStackBackTrace(kSkipFrames, kMaxDepth, frames, nullptr);
+#else
+    void* raw[kMaxDepth + kSkipFrames];
+    int n = backtrace(raw, kMaxDepth + kSkipFrames);
+    int depth = n > kSkipFrames ? n - kSkipFrames : 0;
+    memcpy(frames, raw + kSkipFrames, depth * sizeof(void*));
+    return depth;
+#endif
+}
+
+uint64_t HashFrames(void* const* frames, int depth, size_t interval) {
+    uint64_t h = 1469598103934665603ULL;  // FNV-1a
+    h ^= (uint64_t)interval;
+    h *= 1099511628211ULL;
+    for (int i = 0; i < depth; i++) {
+        h ^= (uint64_t)(uintptr_t)frames[i];
+        h *= 1099511628211ULL;
+    }
+    return h;
+}
+
+// g_Lock을 잡은 상태에서 호출. 실패 시 -1
+int FindOrInsertSite(uint64_t hash, void* const* frames, int depth, size_t interval) {
+    int mask = kMaxSites - 1;
+    for (int probe = 0; probe < kMaxSites; probe++) {
+        int idx = (int)((hash + probe) & mask);
+        CallSite& site = g_Sites[idx];
+        if (site.depth == 0) {
+            if (g_SiteCount >= kMaxSites * 3 / 4) {
+                g_TableFull = true;
+                return -1;
+            }
+            site.hash = hash;
+            site.depth = depth;
+            site.interval = interval;
+            memcpy(site.frames, frames, depth * sizeof(void*));
+            g_SiteCount++;
+            return idx;
+        }
+        if (site.hash == hash && site.depth == depth && site.interval == interval &&
+            memcmp(site.frames, frames, depth * sizeof(void*)) == 0) {
+            return idx;
+        }
+    }
+    g_TableFull = true;
+    return -1;
+}
+
+HEAPPROF_NOINLINE uint32_t RecordSample(size_t size) {
+    if (t_InProfiler) return 0;
+    ReentryGuard guard;
+
+    // 이 스레드의 첫 샘플 판정: 간격을 아직 뽑지 않았으므로 뽑은 뒤 다시 판정
+    if (!t_IntervalDrawn) {
+        t_IntervalDrawn = true;
+        t_BytesUntilSample = NextSampleInterval() - (int64_t)size;
+        if (t_BytesUntilSample >= 0) return 0;
+    }
+    size_t interval = t_DrawnInterval;      // 이 샘플을 뽑은 간격 (다음 간격을 뽑기 전에)
+    t_BytesUntilSample = NextSampleInterval();
+
+    void* frames[kMaxDepth];
+    int depth = CaptureStack(frames);
+    if (depth <= 0) return 0;
+    uint64_t hash = HashFrames(frames, depth, interval);
+
+    g_Lock.lock();
+    int idx = FindOrInsertSite(hash, frames, depth, interval);
+    if (idx >= 0) {
+        CallSite& site = g_Sites[idx];
+        site.liveSamples++;
+        site.liveSampledBytes += size;
+        site.totalSamples++;
+        site.totalSampledBytes += size;
+        g_SampledAllocs++;
+    }
+    g_Lock.unlock();
+
+    return idx >= 0 ? (uint32_t)idx + 1 : 0;
+}
+
+void RecordFree(const AllocHeader* header) {
+    g_Lock.lock();
+    CallSite& site = g_Sites[header->siteId - 1];
+    site.liveSamples--;
+    site.liveSampledBytes -= header->size;
+    g_Lock.unlock();
+}
+
+// ============================================================================
+// 할당 훅 (빠른 경로)
+// ============================================================================
+HEAPPROF_NOINLINE void* AllocateHooked(size_t size) {
+    AllocHeader* header = (AllocHeader*)malloc(sizeof(AllocHeader) + size);
+    if (!header) return nullptr;
+
+    MemCategory category = MemoryBudget::GetCurrentCategory();
+    header->siteId = 0;
+    header->magic = kHeaderMagic;
+    header->category = (uint8_t)category;
+    header->reserved = 0;
+    header->size = size;
+    MemoryBudget::OnAllocate(category, size);
+
+    if (g_Running.load(std::memory_order_relaxed)) {
+        t_BytesUntilSample -= (int64_t)size;
+        if (t_BytesUntilSample < 0) {
+            header->siteId = RecordSample(size);
+        }
+    }
+    return header + 1;
+}
+
+void FreeHooked(void* p) {
+    if (!p) return;
+    AllocHeader* header = (AllocHeader*)p - 1;
+    if (header->magic != kHeaderMagic) {
+        // 이 operator new가 준 포인터가 아님 (malloc/다른 모듈의 new, 두 번째 delete, 앞쪽 버퍼 오버런).
+        // siteId/size를 믿고 계속하면 예산과 샘플 테이블까지 망가지므로 여기서 멈춤
+        fprintf(stderr, "[HeapProfiler] delete할 포인터 %p의 헤더가 올바르지 않습니다 (손상 또는 외부 포인터)\n", p);
+        abort();
+    }
+    if (header->siteId != 0) {
+        RecordFree(header);
+    }
+    MemoryBudget::OnFree((MemCategory)header->category, header->size);
+    header->magic = 0;  // double delete 시 헤더가 그대로 남지 않도록
+    free(header);
+}
+
+HEAPPROF_NOINLINE void* AllocateOrThrow(size_t size) {
+    if (size == 0) size = 1;
+    for (;;) {
+        void* p = AllocateHooked(size);
+        if (p) return p;
+        std::new_handler handler = std::get_new_handler();
+        if (!handler) throw std::bad_alloc();
+        handler();
+    }
+}
+
+// ============================================================================
+// 리포트용 스냅샷 / 심볼
+// ============================================================================
+std::vector<CallSite> SnapshotSites() {
+    std::vector<CallSite> sites;
+    sites.reserve(kMaxSites);
+
+    g_Lock.lock();
+    for (int i = 0; i < kMaxSites; i++) {
+        if (g_Sites[i].depth > 0) sites.push_back(g_Sites[i]);
+    }
+    g_Lock.unlock();
+    return sites;
+}
+
+#ifdef _WIN32
+bool EnsureSymbols() {
+    static bool s_Initialized = false;
+    if (!s_Initialized) {
+        SymSetOptions(SYMOPT_UNDNAME | SYMOPT_DEFERRED_LOADS | SYMOPT_LOAD_LINES);
+        s_Initialized = SymInitialize(GetCurrentProcess(), NULL, TRUE) != FALSE;
+    }
+    return s_Initialized;
+}
+
+void PrintFrame(FILE* out, void* addr) {
+    alignas(SYMBOL_INFO) char buffer[sizeof(SYMBOL_INFO) + 256];
+    SYMBOL_INFO* symbol = (SYMBOL_INFO*)buffer;
+    symbol->SizeOfStruct = sizeof(SYMBOL_INFO);
+    symbol->MaxNameLen = 255;
+
+    DWORD64 displacement = 0;
+    DWORD64 address = (DWORD64)(uintptr_t)addr;
+    if (EnsureSymbols() && SymFromAddr(GetCurrentProcess(), address, &displacement, symbol)) {
+        IMAGEHLP_LINE64 line = {};
+        line.SizeOfStruct = sizeof(line);
+        DWORD lineDisp = 0;
+        if (SymGetLineFromAddr64(GetCurrentProcess(), address, &lineDisp, &line)) {
+            fprintf(out, "      0x%016llX  %s  (%s:%lu)\n",
+                (unsigned long long)address, symbol->Name, line.FileName, line.LineNumber);
+        } else {
+            fprintf(out, "      0x%016llX  %s+0x%llX\n",
+                (unsigned long long)address, symbol->Name, (unsigned long long)displacement);
+        }
+    } else {
+        fprintf(out, "      0x%016llX  ???\n", (unsigned long long)address);
+    }
+}
+
+BOOL CALLBACK WriteModuleLine(PCSTR name, DWORD64 base, ULONG size, PVOID context) {
+    // /proc/self/maps 형식으로 기록 (pprof가 이 형식만 이해함)
+    fprintf((FILE*)context, "%016llx-%016llx r-xp 00000000 00:00 0          %s\n",
+        (unsigned long long)base, (unsigned long long)(base + size), name);
+    return TRUE;
+}
+
+void WriteMappedLibraries(FILE* out) {
+    EnumerateLoadedModules64(GetCurrentProcess(), WriteModuleLine, out);
+}
+#else
+void PrintFrame(FILE* out, void* addr) {
+    char** names = backtrace_symbols(&addr, 1);
+    fprintf(out, "      %p  %s\n", addr, names ? names[0] : "???");
+    free(names);
+}
+
+void WriteMappedLibraries(FILE* out) {
+    FILE* maps = fopen("/proc/self/maps", "r");
+    if (!maps) return;
+    char line[512];
+    while (fgets(line, sizeof(line), maps)) fputs(line, out);
+    fclose(maps);
+}
+#endif
+
+// ============================================================================
+// 종료 시 리포트
+// ============================================================================
+void OnExit() {
+    Stop();
+    ReentryGuard guard;
+
+    Stats stats = GetStats();
+    printf("\n[HeapProfiler] 종료 시 상주 메모리(누수 추정): %llu KB, %llu개 객체 / 콜사이트 %d개\n",
+        (unsigned long long)(stats.liveBytes / 1024),
+        (unsigned long long)stats.liveCount, stats.callSiteCount);
+
+    if (g_Options.leakReportPath) {
+        FILE* out = fopen(g_Options.leakReportPath, "w");
+        if (out) {
+            WriteLeakReport(out, g_Options.maxReportSites);
+            fclose(out);
+            printf("[HeapProfiler] 누수 리포트: %s\n", g_Options.leakReportPath);
+        }
+    }
+    if (g_Options.profilePath && WritePprofProfile(g_Options.profilePath)) {
+        printf("[HeapProfiler] pprof 프로파일: %s\n", g_Options.profilePath);
+    }
+}
+
+} // namespace
+
+// ============================================================================
+// 공개 API
+// ============================================================================
+void Start(const Options& options) {
+    ReentryGuard guard;
+    g_Options = options;
+    g_Interval.store(options.samplingInterval, std::memory_order_relaxed);
+    t_BytesUntilSample = NextSampleInterval();
+    t_IntervalDrawn = true;
+    g_Running.store(true, std::memory_order_relaxed);
+
+    if (!g_ExitHookInstalled) {
+        g_ExitHookInstalled = true;
+        atexit(OnExit);
+    }
+}
+
+void Stop() {
+    g_Running.store(false, std::memory_order_relaxed);
+}
+
+bool IsRunning() {
+    return g_Running.load(std::memory_order_relaxed);
+}
+
+Stats GetStats() {
+    Stats stats = {};
+    double liveBytes = 0, liveCount = 0, totalBytes = 0, totalCount = 0;
+
+    g_Lock.lock();
+    for (int i = 0; i < kMaxSites; i++) {
+        const CallSite& site = g_Sites[i];
+        if (site.depth == 0) continue;
+        double live = UnsampleScale(site.liveSamples, site.liveSampledBytes, site.interval);
+        double total = UnsampleScale(site.totalSamples, site.totalSampledBytes, site.interval);
+        liveBytes  += site.liveSampledBytes * live;
+        liveCount  += site.liveSamples * live;
+        totalBytes += site.totalSampledBytes * total;
+        totalCount += site.totalSamples * total;
+    }
+    stats.sampledAllocs = g_SampledAllocs;
+    stats.callSiteCount = g_SiteCount;
+    stats.tableFull = g_TableFull;
+    g_Lock.unlock();
+
+    stats.liveBytes  = (uint64_t)liveBytes;
+    stats.liveCount  = (uint64_t)liveCount;
+    stats.totalBytes = (uint64_t)totalBytes;
+    stats.totalCount = (uint64_t)totalCount;
+    return stats;
+}
+
+void WriteLeakReport(FILE* out, int maxSites) {
+    ReentryGuard guard;
+    std::vector<CallSite> sites = SnapshotSites();
+
+    // 같은 콜스택이 여러 간격으로 기록됐으면 각자의 간격으로 보정한 뒤 합침
+    struct ReportEntry {
+        const CallSite* site;
+        double liveBytes, liveCount, totalBytes, totalCount;
+    };
+    auto sameStack = [](const CallSite& a, const CallSite& b) {
+        return a.depth == b.depth && memcmp(a.frames, b.frames, a.depth * sizeof(void*)) == 0;
+    };
+    std::vector<ReportEntry> entries;
+    for (const CallSite& site : sites) {
+        double live = UnsampleScale(site.liveSamples, site.liveSampledBytes, site.interval);
+        double total = UnsampleScale(site.totalSamples, site.totalSampledBytes, site.interval);
+        ReportEntry* entry = nullptr;
+        for (ReportEntry& e : entries) {
+            if (sameStack(*e.site, site)) { entry = &e; break; }
+        }
+        if (!entry) {
+            entries.push_back({ &site, 0, 0, 0, 0 });
+            entry = &entries.back();
+        }
+        entry->liveBytes  += site.liveSampledBytes * live;
+        entry->liveCount  += site.liveSamples * live;
+        entry->totalBytes += site.totalSampledBytes * total;
+        entry->totalCount += site.totalSamples * total;
+    }
+    std::sort(entries.begin(), entries.end(), [](const ReportEntry& a, const ReportEntry& b) {
+        return a.liveBytes > b.liveBytes;
+    });
+
+    Stats stats = GetStats();
+    fprintf(out, "==== HeapProfiler 누수 리포트 ====\n");
+    fprintf(out, "샘플링 간격: %zu 바이트, 샘플 수: %llu, 콜사이트: %d%s\n",
+        g_Interval.load(), (unsigned long long)stats.sampledAllocs, stats.callSiteCount,
+        stats.tableFull ? " (테이블 가득 참 - 일부 샘플 누락)" : "");
+    fprintf(out, "상주(추정): %llu 바이트 / %llu개, 누적(추정): %llu 바이트 / %llu개\n\n",
+        (unsigned long long)stats.liveBytes, (unsigned long long)stats.liveCount,
+        (unsigned long long)stats.totalBytes, (unsigned long long)stats.totalCount);
+
+    int printed = 0;
+    for (const ReportEntry& entry : entries) {
+        if (printed >= maxSites) break;
+        if (entry.liveCount == 0) continue;
+
+        fprintf(out, "#%d  상주 %.0f 바이트 (%.0f개), 누적 %.0f 바이트 (%.0f개)\n",
+            printed + 1, entry.liveBytes, entry.liveCount, entry.totalBytes, entry.totalCount);
+        for (int i = 0; i < entry.site->depth; i++) {
+            PrintFrame(out, entry.site->frames[i]);
+        }
+        fprintf(out, "\n");
+        printed++;
+    }
+    if (printed == 0) {
+        fprintf(out, "상주 중인 샘플이 없습니다. (누수 없음)\n");
+    }
+}
+
+bool WritePprofProfile(const char* path) {
+    ReentryGuard guard;
+    FILE* out = fopen(path, "w");
+    if (!out) return false;
+
+    std::vector<CallSite> sites = SnapshotSites();
+
+    // heap_v2 헤더에는 간격이 하나뿐. 모든 샘플이 같은 간격이면 원시값을 기록해 pprof가 보정하게 하고,
+    // 간격이 섞였으면 콜사이트별로 보정한 추정치를 간격 1(보정 없음)로 기록함
+    bool mixed = false;
+    size_t interval = sites.empty() ? g_Interval.load() : sites[0].interval;
+    for (const CallSite& site : sites) {
+        if (site.interval != interval) mixed = true;
+    }
+
+    struct Row { uint64_t liveN, liveB, totalN, totalB; };
+    auto rowOf = [&](const CallSite& site) {
+        if (!mixed) return Row{ site.liveSamples, site.liveSampledBytes, site.totalSamples, site.totalSampledBytes };
+        double live = UnsampleScale(site.liveSamples, site.liveSampledBytes, site.interval);
+        double total = UnsampleScale(site.totalSamples, site.totalSampledBytes, site.interval);
+        return Row{ (uint64_t)std::llround(site.liveSamples * live), (uint64_t)std::llround(site.liveSampledBytes * live),
+                    (uint64_t)std::llround(site.totalSamples * total), (uint64_t)std::llround(site.totalSampledBytes * total) };
+    };
+
+    Row sum = {};
+    for (const CallSite& site : sites) {
+        Row row = rowOf(site);
+        sum.liveN += row.liveN;  sum.liveB += row.liveB;
+        sum.totalN += row.totalN; sum.totalB += row.totalB;
+    }
+
+    size_t headerInterval = mixed ? 1 : interval;
+    fprintf(out, "heap profile: %6llu: %8llu [%6llu: %8llu] @ heap_v2/%zu\n",
+        (unsigned long long)sum.liveN, (unsigned long long)sum.liveB,
+        (unsigned long long)sum.totalN, (unsigned long long)sum.totalB,
+        headerInterval > 1 ? headerInterval : (size_t)1);
+
+    for (const CallSite& site : sites) {
+        Row row = rowOf(site);
+        fprintf(out, "%6llu: %8llu [%6llu: %8llu] @",
+            (unsigned long long)row.liveN, (unsigned long long)row.liveB,
+            (unsigned long long)row.totalN, (unsigned long long)row.totalB);
+        for (int i = 0; i < site.depth; i++) {
+            fprintf(out, " 0x%llx", (unsigned long long)(uintptr_t)site.frames[i]);
+        }
+        fprintf(out, "\n");
+    }
+
+    fprintf(out, "\nMAPPED_LIBRARIES:\n");
+    WriteMappedLibraries(out);
+    fclose(out);
+    return true;
+}
+
+} // namespace HeapProfiler
+
+// ============================================================================
+// 전역 operator new/delete 교체
+// ============================================================================
+void* operator new(size_t size) {
+    return HeapProfiler::AllocateOrThrow(size);
+}
+
+void* operator new[](size_t size) {
+    return HeapProfiler::AllocateOrThrow(size);
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+    try { return HeapProfiler::AllocateOrThrow(size); }
+    catch (...) { return nullptr; }
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept {
+    try { return HeapProfiler::AllocateOrThrow(size); }
+    catch (...) { return nullptr; }
+}
+
+void operator delete(void* p) noexcept                              { HeapProfiler::FreeHooked(p); }
+void operator delete[](void* p) noexcept                            { HeapProfiler::FreeHooked(p); }
+void operator delete(void* p, size_t) noexcept                      { HeapProfiler::FreeHooked(p); }
+void operator delete[](void* p, size_t) noexcept                    { HeapProfiler::FreeHooked(p); }
+void operator delete(void* p, const std::nothrow_t&) noexcept       { HeapProfiler::FreeHooked(p); }
+void operator delete[](void* p, const std::nothrow_t&) noexcept     { HeapProfiler::FreeHooked(p); }
@@ -0,0 +1,73 @@
+/*============================================================================
+ *  HeapProfiler - 콜사이트별 샘플링 힙 프로파일러
+ *  ---------------------------------------------------------------------------
+ *  전역 operator new/delete를 교체하여 할당을 가로챕니다.
+ *  평균 samplingInterval 바이트마다 한 번씩(지수분포) 할당을 샘플링하고,
+ *  샘플된 할당의 콜스택을 기록해서 콜사이트별 상주(live)/누적 바이트를 집계합니다.
+ *
+ *  - 샘플링되지 않은 할당: thread_local 카운터 감소 + 비교 1회 (빠른 경로)
+ *  - 샘플링된 할당:        콜스택 캡처 + 콜사이트 테이블 갱신 (느린 경로)
+ *  - 종료 시: 누수 리포트(텍스트) + pprof 호환 힙 프로파일 파일 생성
+ *
+ *  기본 간격(512KB)은 tcmalloc과 같으며, 이 정도면 오버헤드가 2% 미만입니다.
+ *  간격을 1로 주면 모든 할당을 기록합니다 (디버깅용, 느림).
+ *
+ *  [사용법]
+ *      HeapProfiler::Options opt;
+ *      opt.samplingInterval = 64 * 1024;
+ *      HeapProfiler::Start(opt);   // 종료 시 리포트 자동 생성
+ *
+ *      pprof --text 04_MemoryLeak.exe HeapProfile.heap
+ *
+ *  같은 훅에서 MemoryBudget(카테고리별 사용량)도 함께 집계합니다.
+ *
+ *  [주의] 정렬 new(operator new(size_t, std::align_val_t))는 교체하지 않으므로
+ *  alignas(32) 이상의 타입 할당은 프로파일에 나타나지 않습니다.
+ *============================================================================*/
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+
+namespace HeapProfiler {
+
+struct Options {
+    // 평균 샘플링 간격 (바이트). 1 이하면 모든 할당을 샘플링
+    size_t      samplingInterval = 512 * 1024;
+    // 종료 시 생성할 파일 (nullptr이면 생성 안 함)
+    const char* leakReportPath   = "HeapLeakReport.txt";
+    const char* profilePath      = "HeapProfile.heap";
+    // 리포트에 출력할 최대 콜사이트 수
+    int         maxReportSites   = 20;
+};
+
+// 전체 통계 (샘플 기반 추정치, 바이트/개수)
+struct Stats {
+    uint64_t liveBytes;
+    uint64_t liveCount;
+    uint64_t totalBytes;
+    uint64_t totalCount;
+    uint64_t sampledAllocs;   // 실제로 샘플링된 할당 수
+    int      callSiteCount;   // 기록된 고유 콜사이트 수
+    bool     tableFull;       // 콜사이트 테이블이 가득 차서 버려진 샘플이 있음
+};
+
+// 프로파일링 시작. 처음 호출 시 atexit에 종료 리포트를 등록합니다.
+// 간격을 바꿔 다시 시작해도 이미 기록된 샘플은 그 샘플을 뽑은 간격으로 보정됩니다.
+void Start(const Options& options = Options());
+
+// 샘플링 중지 (이미 기록된 데이터는 유지)
+void Stop();
+
+bool IsRunning();
+
+Stats GetStats();
+
+// 상주 바이트 기준 상위 콜사이트를 심볼과 함께 출력
+void WriteLeakReport(FILE* out, int maxSites);
+
+// gperftools heap_v2 텍스트 포맷으로 저장 (pprof / go tool pprof에서 읽을 수 있음)
+bool WritePprofProfile(const char* path);
+
+} // namespace HeapProfiler
@@ -0,0 +1,190 @@
+/*============================================================================
+ *  MemoryBudget.cpp - 스레드별 슬롯 카운터 + 워터마크/예산 검사
+ *  ---------------------------------------------------------------------------
+ *  operator new 안에서 불리므로 여기서는 힙을 쓰지 않습니다.
+ *  모든 전역 상태는 정적 배열이며 0으로 초기화된 상태에서 바로 동작합니다.
+ *============================================================================*/
+#include "MemoryBudget.h"
+
+#include <atomic>
+
+namespace MemoryBudget {
+namespace {
+
+const int kMaxThreadSlots = 128;
+const int kSharedSlot     = kMaxThreadSlots;  // 슬롯이 부족할 때 공용으로 쓰는 슬롯
+
+// 캐시라인 정렬: 다른 스레드의 슬롯과 같은 캐시라인을 공유하지 않음 (false sharing 방지)
+struct alignas(64) ThreadSlot {
+    std::atomic<int64_t> bytes[kCategoryCount];
+    std::atomic<int64_t> count[kCategoryCount];
+    std::atomic<bool>    inUse;
+};
+
+struct CategoryState {
+    std::atomic<int64_t>            peak;
+    std::atomic<int64_t>            budget;
+    std::atomic<OverBudgetCallback> callback;
+    std::atomic<void*>              userData;
+    std::atomic<bool>               over;     // 콜백을 이미 호출했는지 (중복 호출 방지)
+};
+
+ThreadSlot       g_Slots[kMaxThreadSlots + 1];
+std::atomic<int> g_SlotLimit{0};              // 사용된 적 있는 슬롯 인덱스의 상한
+CategoryState    g_Categories[kCategoryCount];
+
+const char* const kCategoryNames[kCategoryCount] = {
+    "General", "Mesh", "Asset", "FSM", "Scene"
+};
+
+thread_local MemCategory t_Category = MemCategory::General;
+
+// 스레드 종료 시 슬롯을 반납. 반납 후 새로 들어오는 할당은 공용 슬롯으로 보냄
+// (카운터는 증감량의 합이므로 다른 스레드가 슬롯을 이어서 써도 합계는 정확함)
+struct SlotOwner {
+    int index = -1;
+    ~SlotOwner() {
+        if (index >= 0 && index < kMaxThreadSlots) {
+            g_Slots[index].inUse.store(false, std::memory_order_release);
+        }
+        index = kSharedSlot;
+    }
+};
+thread_local SlotOwner t_Slot;
+
+int ClaimSlot() {
+    for (int i = 0; i < kMaxThreadSlots; i++) {
+        bool expected = false;
+        if (!g_Slots[i].inUse.load(std::memory_order_relaxed) &&
+            g_Slots[i].inUse.compare_exchange_strong(expected, true, std::memory_order_acquire)) {
+            int limit = g_SlotLimit.load(std::memory_order_relaxed);
+            while (limit < i + 1 &&
+                   !g_SlotLimit.compare_exchange_weak(limit, i + 1, std::memory_order_release)) {}
+            return i;
+        }
+    }
+    return kSharedSlot;
+}
+
+void AddToSlot(MemCategory category, int64_t bytes, int64_t count) {
+    int index = t_Slot.index;
+    if (index < 0) {
+        index = ClaimSlot();
+        t_Slot.index = index;
+    }
+
+    ThreadSlot& slot = g_Slots[index];
+    int c = (int)category;
+    if (index == kSharedSlot) {
+        // 공용 슬롯은 여러 스레드가 쓰므로 RMW 필요
+        slot.bytes[c].fetch_add(bytes, std::memory_order_relaxed);
+        slot.count[c].fetch_add(count, std::memory_order_relaxed);
+    } else {
+        // 내 슬롯에는 나만 씀 → load + store (lock 접두어 없는 일반 쓰기)
+        slot.bytes[c].store(slot.bytes[c].load(std::memory_order_relaxed) + bytes,
+                            std::memory_order_relaxed);
+        slot.count[c].store(slot.count[c].load(std::memory_order_relaxed) + count,
+                            std::memory_order_relaxed);
+    }
+}
+
+void SumCategory(int c, int64_t& bytes, int64_t& count) {
+    bytes = 0;
+    count = 0;
+    int limit = g_SlotLimit.load(std::memory_order_acquire);
+    for (int i = 0; i < limit; i++) {
+        bytes += g_Slots[i].bytes[c].load(std::memory_order_relaxed);
+        count += g_Slots[i].count[c].load(std::memory_order_relaxed);
+    }
+    bytes += g_Slots[kSharedSlot].bytes[c].load(std::memory_order_relaxed);
+    count += g_Slots[kSharedSlot].count[c].load(std::memory_order_relaxed);
+}
+
+void CheckCategory(int c) {
+    int64_t bytes, count;
+    SumCategory(c, bytes, count);
+
+    CategoryState& state = g_Categories[c];
+    int64_t peak = state.peak.load(std::memory_order_relaxed);
+    while (bytes > peak &&
+           !state.peak.compare_exchange_weak(peak, bytes, std::memory_order_relaxed)) {}
+
+    int64_t budget = state.budget.load(std::memory_order_relaxed);
+    if (budget <= 0) return;
+
+    if (bytes > budget) {
+        if (!state.over.exchange(true, std::memory_order_acq_rel)) {
+            OverBudgetCallback callback = state.callback.load(std::memory_order_acquire);
+            if (callback) {
+                callback((MemCategory)c, bytes, budget,
+                         state.userData.load(std::memory_order_relaxed));
+            }
+        }
+    } else if (state.over.load(std::memory_order_relaxed)) {
+        state.over.store(false, std::memory_order_relaxed);
+    }
+}
+
+} // namespace
+
+const char* GetCategoryName(MemCategory category) {
+    int c = (int)category;
+    return (c >= 0 && c < kCategoryCount) ? kCategoryNames[c] : "Unknown";
+}
+
+MemCategory GetCurrentCategory() {
+    return t_Category;
+}
+
+void SetCurrentCategory(MemCategory category) {
+    t_Category = category;
+}
+
+void SetBudget(MemCategory category, int64_t budgetBytes,
+               OverBudgetCallback callback, void* userData) {
+    CategoryState& state = g_Categories[(int)category];
+    state.userData.store(userData, std::memory_order_relaxed);
+    state.callback.store(callback, std::memory_order_release);
+    state.over.store(false, std::memory_order_relaxed);
+    state.budget.store(budgetBytes, std::memory_order_relaxed);
+}
+
+Snapshot GetSnapshot() {
+    Snapshot snapshot = {};
+    for (int c = 0; c < kCategoryCount; c++) {
+        CategoryStats& stats = snapshot.categories[c];
+        SumCategory(c, stats.currentBytes, stats.currentCount);
+        stats.peakBytes = g_Categories[c].peak.load(std::memory_order_relaxed);
+        stats.budgetBytes = g_Categories[c].budget.load(std::memory_order_relaxed);
+        if (stats.peakBytes < stats.currentBytes) stats.peakBytes = stats.currentBytes;
+    }
+    return snapshot;
+}
+
+Snapshot Poll() {
+    for (int c = 0; c < kCategoryCount; c++) {
+        CheckCategory(c);
+    }
+    return GetSnapshot();
+}
+
+void ResetPeaks() {
+    for (int c = 0; c < kCategoryCount; c++) {
+        int64_t bytes, count;
+        SumCategory(c, bytes, count);
+        g_Categories[c].peak.store(bytes, std::memory_order_relaxed);
+    }
+}
+
+void OnAllocate(MemCategory category, size_t size) {
+    AddToSlot(category, (int64_t)size, 1);
+    if (size >= kLargeAllocation) {
+        CheckCategory((int)category);
+    }
+}
+
+void OnFree(MemCategory category, size_t size) {
+    AddToSlot(category, -(int64_t)size, -1);
+}
+
+} // namespace MemoryBudget
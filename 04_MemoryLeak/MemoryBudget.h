@@ -0,0 +1,96 @@
+/*============================================================================
+ *  MemoryBudget - 카테고리별 메모리 예산 추적
+ *  ---------------------------------------------------------------------------
+ *  할당을 Mesh / Asset / FSM / Scene 등의 카테고리로 분류하고
+ *  카테고리별 현재 사용량, 최고 사용량(high-watermark), 예산 초과를 추적합니다.
+ *
+ *  [카테고리 지정]
+ *  스코프 태그를 걸면 그 스코프 안의 모든 new가 해당 카테고리로 기록됩니다.
+ *  (HeapProfiler.cpp의 operator new 훅이 헤더에 카테고리를 저장하므로
+ *   어느 스레드에서 delete 하든 올바른 카테고리에서 빠집니다.)
+ *
+ *      {
+ *          MemoryBudget::ScopedCategory tag(MemCategory::Mesh);
+ *          renderer = new MeshRenderer();   // meshData 40KB도 Mesh로 기록
+ *      }
+ *
+ *  [카운터 구조]
+ *  스레드마다 캐시라인 정렬된 슬롯을 하나씩 갖고, 자기 슬롯에만 씁니다.
+ *  → 할당 경로에 lock도, atomic RMW(lock add)도 없습니다.
+ *  읽는 쪽은 모든 슬롯을 합산하므로 백그라운드 스레드에서 게임을 멈추지 않고
+ *  언제든 GetSnapshot()을 호출할 수 있습니다.
+ *
+ *  [워터마크 / 예산 초과 콜백]
+ *  - Poll()을 호출할 때 (프레임 끝 또는 백그라운드 스레드에서 주기적으로)
+ *  - kLargeAllocation 이상의 큰 할당이 일어났을 때 (할당한 스레드에서 즉시)
+ *  합계를 계산해서 워터마크를 올리고, 예산을 처음 넘는 순간 콜백을 한 번 호출합니다.
+ *  예산 아래로 내려가면 다시 콜백이 걸릴 수 있는 상태가 됩니다.
+ *============================================================================*/
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+enum class MemCategory : uint8_t {
+    General,
+    Mesh,
+    Asset,
+    FSM,
+    Scene,
+    Count
+};
+
+namespace MemoryBudget {
+
+const int    kCategoryCount   = (int)MemCategory::Count;
+const size_t kLargeAllocation = 64 * 1024;  // 이 크기 이상이면 할당 즉시 예산 검사
+
+// 예산 초과 콜백 (검사를 수행한 스레드에서 호출됨 - 가볍게 작성할 것)
+typedef void (*OverBudgetCallback)(MemCategory category, int64_t currentBytes,
+                                   int64_t budgetBytes, void* userData);
+
+struct CategoryStats {
+    int64_t currentBytes;
+    int64_t currentCount;
+    int64_t peakBytes;
+    int64_t budgetBytes;   // 0이면 예산 없음
+};
+
+struct Snapshot {
+    CategoryStats categories[kCategoryCount];
+};
+
+const char* GetCategoryName(MemCategory category);
+
+// 현재 스레드의 할당 카테고리
+MemCategory GetCurrentCategory();
+void        SetCurrentCategory(MemCategory category);
+
+class ScopedCategory {
+    MemCategory m_Prev;
+public:
+    explicit ScopedCategory(MemCategory category) : m_Prev(GetCurrentCategory()) {
+        SetCurrentCategory(category);
+    }
+    ~ScopedCategory() { SetCurrentCategory(m_Prev); }
+
+    ScopedCategory(const ScopedCategory&) = delete;
+    ScopedCategory& operator=(const ScopedCategory&) = delete;
+};
+
+void SetBudget(MemCategory category, int64_t budgetBytes,
+               OverBudgetCallback callback = nullptr, void* userData = nullptr);
+
+// 모든 스레드 슬롯을 합산 (락 없음, 어느 스레드에서나 호출 가능)
+Snapshot GetSnapshot();
+
+// 워터마크 갱신 + 예산 검사. 갱신된 스냅샷을 돌려줌
+Snapshot Poll();
+
+void ResetPeaks();
+
+// operator new/delete 훅에서 호출
+void OnAllocate(MemCategory category, size_t size);
+void OnFree(MemCategory category, size_t size);
+
+} // namespace MemoryBudget
@@ -0,0 +1,141 @@
+/*============================================================================
+ *  RendererRegistry - 구체 타입별로 묶어서 그리는 배치 디스패치
+ *  ---------------------------------------------------------------------------
+ *  IRenderer* 배열을 하나씩 Render()하면 객체 N개마다 가상 호출(간접 분기)이
+ *  한 번씩 일어나고, 타입이 섞여 있으면 분기 예측도 계속 실패합니다.
+ *
+ *  이 레지스트리는 인스턴스를 구체 타입(T)별 버킷에 모아두고
+ *  타입마다 RenderBatch(Span<T*>)를 한 번 호출합니다.
+ *  → 가상 호출 N번이 "타입 수(K)번 + 타입별 비가상 루프"로 바뀝니다.
+ *
+ *  [배치 함수 결정 규칙]
+ *  - T에 static void RenderBatch(Span<T*>)가 있으면 그것을 호출
+ *  - 없으면 기본 루프: item->T::Render()  (한정 이름 호출 → 컴파일러가 가상 호출을 제거)
+ *
+ *  레지스트리는 인스턴스를 소유하지 않습니다. 파괴 전에 Unregister 하세요.
+ *============================================================================*/
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// C++17에는 std::span이 없으므로 최소 기능만 가진 뷰를 사용
+template <typename T>
+struct Span {
+    T*     data = nullptr;
+    size_t size = 0;
+
+    T* begin() const { return data; }
+    T* end() const   { return data + size; }
+    T& operator[](size_t i) const { return data[i]; }
+};
+
+class RendererRegistry {
+    // 타입이 지워진 버킷 - 가상 호출은 버킷당 한 번만 일어남
+    class IBatch {
+    public:
+        virtual ~IBatch() = default;
+        virtual void RenderAll() = 0;
+        virtual size_t Count() const = 0;
+    };
+
+    // T::RenderBatch(Span<T*>) 존재 여부 검사
+    template <typename T, typename = void>
+    struct HasRenderBatch : std::false_type {};
+
+    template <typename T>
+    struct HasRenderBatch<T, std::void_t<decltype(T::RenderBatch(std::declval<Span<T*>>()))>>
+        : std::true_type {};
+
+    template <typename T>
+    class TypedBatch : public IBatch {
+    public:
+        std::vector<T*> items;
+
+        void RenderAll() override {
+            Span<T*> span{ items.data(), items.size() };
+            if constexpr (HasRenderBatch<T>::value) {
+                T::RenderBatch(span);
+            } else {
+                for (T* item : span) {
+                    item->T::Render();  // 비가상 호출
+                }
+            }
+        }
+
+        size_t Count() const override { return items.size(); }
+    };
+
+    // 타입마다 고유한 인덱스 (RTTI 없이 타입 구분)
+    static size_t NextTypeIndex() {
+        static size_t s_Counter = 0;
+        return s_Counter++;
+    }
+
+    template <typename T>
+    static size_t TypeIndex() {
+        static const size_t s_Index = NextTypeIndex();
+        return s_Index;
+    }
+
+    template <typename T>
+    TypedBatch<T>& GetBatch() {
+        size_t index = TypeIndex<T>();
+        if (index >= m_BatchByType.size()) {
+            m_BatchByType.resize(index + 1, nullptr);
+        }
+        if (!m_BatchByType[index]) {
+            m_Batches.push_back(std::make_unique<TypedBatch<T>>());
+            m_BatchByType[index] = m_Batches.back().get();
+        }
+        return *static_cast<TypedBatch<T>*>(m_BatchByType[index]);
+    }
+
+    std::vector<std::unique_ptr<IBatch>> m_Batches;      // 등록 순서대로 순회
+    std::vector<IBatch*>                 m_BatchByType;  // TypeIndex → 버킷
+
+public:
+    // T는 구체(최종) 타입이어야 합니다. 기반 타입 포인터로 등록하면
+    // 기반 타입 버킷에 들어가서 배치의 의미가 없어집니다.
+    template <typename T>
+    void Register(T* renderer) {
+        static_assert(!std::is_abstract<T>::value, "구체 타입 포인터로 등록하세요");
+        GetBatch<T>().items.push_back(renderer);
+    }
+
+    // 순서를 유지하지 않는 swap-and-pop 제거 (버킷 크기에 비례)
+    template <typename T>
+    bool Unregister(T* renderer) {
+        std::vector<T*>& items = GetBatch<T>().items;
+        for (size_t i = 0; i < items.size(); i++) {
+            if (items[i] == renderer) {
+                items[i] = items.back();
+                items.pop_back();
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void RenderAll() {
+        for (auto& batch : m_Batches) {
+            batch->RenderAll();
+        }
+    }
+
+    size_t TypeCount() const { return m_Batches.size(); }
+
+    size_t InstanceCount() const {
+        size_t count = 0;
+        for (auto& batch : m_Batches) count += batch->Count();
+        return count;
+    }
+
+    void Clear() {
+        m_Batches.clear();
+        m_BatchByType.clear();
+    }
+};
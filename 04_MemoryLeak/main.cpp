@@ -11,6 +11,20 @@
 #include <string>
 #include <vector>
 #include <cstdlib>
+#include <chrono>
+#include <cstring>
+#include <random>
+#include <array>
+#include <utility>
+#include <new>
+#include <thread>
+#include <atomic>
+#include <iomanip>
+
+// 전역 operator new/delete를 교체하는 샘플링 힙 프로파일러
+#include "HeapProfiler.h"
+#include "RendererRegistry.h"
+#include "MemoryBudget.h"
 
 // ============================================================================
 // 간이 클래스들
@@ -75,6 +89,7 @@ void BugA_DestructorWithoutDelete() {
     const int COUNT = 1000;
     std::cout << "  " << COUNT << "개 객체를 생성하고 소멸자만 호출합니다...\n";
 
+    MemoryBudget::ScopedCategory tag(MemCategory::FSM);
     for (int i = 0; i < COUNT; i++) {
         ObjectSlot slot;
         slot.ptr = new IdleState();
@@ -98,6 +113,7 @@ public:
     IState* curState;
 
     void Init() {
+        MemoryBudget::ScopedCategory tag(MemCategory::FSM);
         // BAD: new로 생성하지만 소멸자에서 delete 없음!
         fsmStates[0] = new IdleState();
         fsmStates[1] = new WalkState();
@@ -123,6 +139,7 @@ void BugB_FSMStateLeaks() {
     const int ITERATIONS = 500;
     std::cout << "  " << ITERATIONS << "번 PlayerController 생성/파괴를 반복합니다...\n";
 
+    MemoryBudget::ScopedCategory tag(MemCategory::Scene);
     for (int i = 0; i < ITERATIONS; i++) {
         PlayerController* pc = new PlayerController();
         pc->Init();
@@ -144,7 +161,11 @@ void BugC_MissingVirtualDestructor() {
     std::cout << "  파생 클래스의 소멸자가 호출되지 않습니다.\n\n";
 
     std::cout << "  IRenderer* = new MeshRenderer() 생성...\n";
-    IRenderer* renderer = new MeshRenderer();
+    IRenderer* renderer = nullptr;
+    {
+        MemoryBudget::ScopedCategory tag(MemCategory::Mesh);
+        renderer = new MeshRenderer();
+    }
     renderer->Render();
 
     std::cout << "  delete renderer 호출...\n";
@@ -168,6 +189,7 @@ struct FBXAsset {
 };
 
 FBXAsset* LoadAsset(const std::string& path) {
+    MemoryBudget::ScopedCategory tag(MemCategory::Asset);
     // BAD: 캐시 검색 없이 매번 새로 로드!
     auto* asset = new FBXAsset(path);
     return asset;
@@ -194,10 +216,254 @@ void BugD_RepeatedLoadingWithoutCache() {
     delete currentAsset;
 }
 
+// ============================================================================
+// E: 힙 프로파일러 - 콜사이트별 상주 메모리 확인
+// ============================================================================
+void ShowHeapProfile() {
+    std::cout << "\n[E] 힙 프로파일러 리포트 (콜사이트별 상주 메모리)\n";
+    std::cout << "  A/B/D를 실행한 뒤 보면 누수를 만든 콜스택이 상위에 나타납니다.\n\n";
+
+    HeapProfiler::Stats stats = HeapProfiler::GetStats();
+    std::cout << "  상주(추정): " << stats.liveBytes / 1024 << " KB, "
+              << stats.liveCount << "개 객체\n";
+    std::cout << "  누적(추정): " << stats.totalBytes / 1024 << " KB, "
+              << stats.totalCount << "개 객체\n";
+    std::cout << "  샘플 수: " << stats.sampledAllocs
+              << ", 콜사이트: " << stats.callSiteCount << "\n\n";
+
+    std::cout.flush();
+    HeapProfiler::WriteLeakReport(stdout, 5);
+    fflush(stdout);
+
+    std::cout << "  [참고] 종료(Q) 시 HeapLeakReport.txt, HeapProfile.heap 파일이 생성됩니다.\n";
+    std::cout << "  pprof --text 04_MemoryLeak.exe HeapProfile.heap 으로 분석할 수 있습니다.\n";
+}
+
+// ============================================================================
+// F: 프로파일러 오버헤드 측정
+// ============================================================================
+double MeasureAllocLoop(int count) {
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < count; i++) {
+        // 16 ~ 1024 바이트 사이의 다양한 크기로 할당 → 초기화 → 해제
+        size_t size = 16 + (i * 37) % 1009;
+        char* p = new char[size];
+        memset(p, i, size);
+        delete[] p;
+    }
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+void MeasureProfilerOverhead() {
+    std::cout << "\n[F] 힙 프로파일러 오버헤드 측정\n";
+    std::cout << "  같은 할당 루프를 샘플링 OFF / ON 상태에서 비교합니다.\n";
+    std::cout << "  이 루프는 할당만 하는 최악의 경우이므로, 샘플 1회 비용으로\n";
+    std::cout << "  '오버헤드 2% 이하가 유지되는 할당 속도'를 함께 계산합니다.\n";
+    std::cout << "  (Debug 빌드에서는 수치가 크게 왜곡되므로 Release에서 측정하세요)\n\n";
+
+    const int COUNT = 2000000;
+    bool wasRunning = HeapProfiler::IsRunning();
+    const size_t intervals[] = { 512 * 1024, 64 * 1024, 4 * 1024 };
+
+    HeapProfiler::Stop();
+    MeasureAllocLoop(COUNT / 10);  // 워밍업
+    double baseline = MeasureAllocLoop(COUNT);
+    std::cout << "  샘플링 OFF : " << baseline << " ms\n";
+
+    for (size_t interval : intervals) {
+        HeapProfiler::Options opt;
+        opt.samplingInterval = interval;
+        opt.leakReportPath = nullptr;
+        opt.profilePath = nullptr;
+
+        uint64_t samplesBefore = HeapProfiler::GetStats().sampledAllocs;
+        HeapProfiler::Start(opt);
+        double ms = MeasureAllocLoop(COUNT);
+        HeapProfiler::Stop();
+        uint64_t samples = HeapProfiler::GetStats().sampledAllocs - samplesBefore;
+
+        std::cout << "  샘플링 간격 " << interval / 1024 << "KB : " << ms << " ms ("
+                  << (ms / baseline - 1.0) * 100.0 << "%), 샘플 " << samples << "회\n";
+
+        if (samples > 0 && ms > baseline) {
+            // 샘플 1회 비용(초) / 0.02 = 간격당 필요한 실행 시간 → 허용 할당 속도
+            double perSampleSec = (ms - baseline) / 1000.0 / (double)samples;
+            double maxRateMB = (double)interval / (perSampleSec / 0.02) / (1024.0 * 1024.0);
+            std::cout << "      샘플 1회 비용 " << perSampleSec * 1e6 << " us → 초당 "
+                      << maxRateMB << " MB 이하로 할당하면 오버헤드 2% 미만\n";
+        }
+    }
+
+    // 데모 설정으로 복구 (종료 리포트 경로도 기본값으로)
+    if (wasRunning) {
+        HeapProfiler::Options opt;
+        opt.samplingInterval = 64 * 1024;
+        HeapProfiler::Start(opt);
+    }
+    std::cout << "\n  [결과] 게임 프레임당 할당량은 보통 수 MB 이하이므로\n";
+    std::cout << "  기본 간격(512KB)이면 실서비스 빌드에서도 2% 미만으로 유지됩니다.\n";
+}
+
+// ============================================================================
+// G: 렌더러 타입별 배치 디스패치 벤치마크
+// ============================================================================
+// 10종의 렌더러 타입 (final → 한정 이름 호출이 확실하게 비가상 호출이 됨)
+template <int N>
+class BenchRenderer final : public IRenderer {
+    float m_Value = 0.0f;
+public:
+    void Render() override { m_Value = m_Value * 0.5f + (float)N; }
+};
+
+template <int N>
+IRenderer* CreateBenchRenderer(void* memory, RendererRegistry& registry) {
+    auto* renderer = new (memory) BenchRenderer<N>();
+    registry.Register(renderer);
+    return renderer;
+}
+
+template <size_t... Ns>
+constexpr auto MakeBenchFactories(std::index_sequence<Ns...>) {
+    using Factory = IRenderer* (*)(void*, RendererRegistry&);
+    return std::array<Factory, sizeof...(Ns)>{ &CreateBenchRenderer<(int)Ns>... };
+}
+
+void BenchmarkBatchedRenderers() {
+    std::cout << "\n[G] 렌더러 타입별 배치 디스패치 벤치마크\n";
+    std::cout << "  IRenderer* 하나씩 가상 호출 vs 타입별로 묶어서 비가상 루프\n";
+    std::cout << "  (Debug 빌드에서는 수치가 크게 왜곡되므로 Release에서 측정하세요)\n\n";
+
+    const int TYPE_COUNT = 10;
+    const int INSTANCE_COUNT = 1000000;
+    const int ROUNDS = 10;
+    const size_t OBJECT_SIZE = sizeof(BenchRenderer<0>);
+
+    // 두 방식이 같은 메모리 배치를 쓰도록 하나의 버퍼에 타입을 섞어서 배치
+    std::vector<unsigned char> arena(OBJECT_SIZE * INSTANCE_COUNT);
+    std::vector<IRenderer*> renderers(INSTANCE_COUNT);
+    RendererRegistry registry;
+
+    const auto factories = MakeBenchFactories(std::make_index_sequence<TYPE_COUNT>());
+    std::mt19937 rng(1234);
+    for (int i = 0; i < INSTANCE_COUNT; i++) {
+        renderers[i] = factories[rng() % TYPE_COUNT](&arena[i * OBJECT_SIZE], registry);
+    }
+
+    std::cout << "  타입 " << registry.TypeCount() << "종, 인스턴스 "
+              << registry.InstanceCount() << "개, " << ROUNDS << "회 반복\n\n";
+
+    auto start = std::chrono::steady_clock::now();
+    for (int r = 0; r < ROUNDS; r++) {
+        for (IRenderer* renderer : renderers) {
+            renderer->Render();  // 객체마다 가상 호출
+        }
+    }
+    auto mid = std::chrono::steady_clock::now();
+    for (int r = 0; r < ROUNDS; r++) {
+        registry.RenderAll();    // 타입마다 가상 호출 1회
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    double virtualNs = std::chrono::duration<double, std::nano>(mid - start).count()
+                     / ((double)INSTANCE_COUNT * ROUNDS);
+    double batchedNs = std::chrono::duration<double, std::nano>(end - mid).count()
+                     / ((double)INSTANCE_COUNT * ROUNDS);
+
+    std::cout << "  객체별 가상 호출   : " << virtualNs << " ns/객체\n";
+    std::cout << "  타입별 배치 호출   : " << batchedNs << " ns/객체\n";
+    std::cout << "  속도 향상          : " << virtualNs / batchedNs << "x\n";
+    std::cout << "\n  [결과] 간접 호출 " << INSTANCE_COUNT << "번이 타입 수("
+              << TYPE_COUNT << ")번으로 줄어듭니다.\n";
+    // BenchRenderer는 소멸자가 하는 일이 없으므로 arena 해제로 충분
+}
+
+// ============================================================================
+// H: 카테고리별 메모리 예산 / 워터마크
+// ============================================================================
+void OnOverBudget(MemCategory category, int64_t currentBytes, int64_t budgetBytes, void*) {
+    // 할당한 스레드(또는 Poll 스레드)에서 호출됨 - 출력만 하고 바로 리턴
+    printf("    [Budget] %s 예산 초과! %lld KB / 예산 %lld KB\n",
+           MemoryBudget::GetCategoryName(category),
+           (long long)(currentBytes / 1024), (long long)(budgetBytes / 1024));
+}
+
+void SetupMemoryBudgets() {
+    MemoryBudget::SetBudget(MemCategory::Mesh,  100 * 1024,       OnOverBudget);
+    MemoryBudget::SetBudget(MemCategory::Asset, 4 * 1024 * 1024,  OnOverBudget);
+    MemoryBudget::SetBudget(MemCategory::FSM,   1024 * 1024,      OnOverBudget);
+    MemoryBudget::SetBudget(MemCategory::Scene, 64 * 1024,        OnOverBudget);
+}
+
+void PrintBudgetTable(const MemoryBudget::Snapshot& snapshot) {
+    std::cout << "    카테고리   현재(KB)    개수   최고(KB)   예산(KB)\n";
+    for (int c = 0; c < MemoryBudget::kCategoryCount; c++) {
+        const MemoryBudget::CategoryStats& stats = snapshot.categories[c];
+        std::cout << "    " << std::left << std::setw(8)
+                  << MemoryBudget::GetCategoryName((MemCategory)c) << std::right
+                  << std::setw(11) << stats.currentBytes / 1024
+                  << std::setw(8) << stats.currentCount
+                  << std::setw(11) << stats.peakBytes / 1024;
+        if (stats.budgetBytes > 0) {
+            std::cout << std::setw(11) << stats.budgetBytes / 1024
+                      << (stats.currentBytes > stats.budgetBytes ? "  초과!" : "");
+        } else {
+            std::cout << std::setw(11) << "-";
+        }
+        std::cout << "\n";
+    }
+}
+
+void DemoMemoryBudget() {
+    std::cout << "\n[H] 카테고리별 메모리 예산 / 워터마크\n";
+    std::cout << "  A~D에서 만든 할당이 Mesh/Asset/FSM/Scene으로 분류되어 집계됩니다.\n\n";
+
+    std::cout << "  --- 현재 상태 ---\n";
+    PrintBudgetTable(MemoryBudget::Poll());
+
+    // 게임 스레드가 에셋을 로드/해제하는 동안 백그라운드 스레드가 카운터를 읽음
+    std::cout << "\n  --- 백그라운드 모니터 (게임 스레드는 멈추지 않음) ---\n";
+    std::atomic<bool> running{true};
+    std::thread monitor([&running]() {
+        while (running.load()) {
+            MemoryBudget::Snapshot snapshot = MemoryBudget::Poll();
+            const MemoryBudget::CategoryStats& asset =
+                snapshot.categories[(int)MemCategory::Asset];
+            printf("    [Monitor] Asset 현재 %lld KB, 최고 %lld KB\n",
+                   (long long)(asset.currentBytes / 1024), (long long)(asset.peakBytes / 1024));
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        }
+    });
+
+    for (int frame = 0; frame < 20; frame++) {
+        // 한 프레임 동안 에셋 몇 개를 로드했다가 해제 (정상 코드)
+        std::vector<FBXAsset*> loaded;
+        for (int i = 0; i < frame % 8; i++) {
+            loaded.push_back(LoadAsset("models/streaming.fbx"));
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        for (FBXAsset* asset : loaded) delete asset;
+    }
+
+    running.store(false);
+    monitor.join();
+
+    std::cout << "\n  --- 최종 상태 ---\n";
+    PrintBudgetTable(MemoryBudget::Poll());
+    std::cout << "\n  [결과] 최고 사용량(워터마크)은 해제 후에도 남아서\n";
+    std::cout << "  순간적인 메모리 스파이크를 놓치지 않습니다.\n";
+}
+
 // ============================================================================
 // 메인
 // ============================================================================
 int main() {
+    // 데모용으로 64KB마다 샘플링 (기본값 512KB보다 촘촘하게)
+    HeapProfiler::Options profilerOptions;
+    profilerOptions.samplingInterval = 64 * 1024;
+    HeapProfiler::Start(profilerOptions);
+    SetupMemoryBudgets();
+
     std::cout << "====================================================\n";
     std::cout << "  ZeroCrashLab - 04. Memory Leak\n";
     std::cout << "  (메모리 누수)\n";
@@ -209,6 +475,10 @@ int main() {
     std::cout << "  [B] FSM 상태 객체 new 후 미해제\n";
     std::cout << "  [C] 가상 소멸자 누락\n";
     std::cout << "  [D] 캐시 없이 반복 로딩\n";
+    std::cout << "  [E] 힙 프로파일러 리포트 (콜사이트별 상주 메모리)\n";
+    std::cout << "  [F] 힙 프로파일러 오버헤드 측정\n";
+    std::cout << "  [G] 렌더러 타입별 배치 디스패치 벤치마크\n";
+    std::cout << "  [H] 카테고리별 메모리 예산 / 워터마크\n";
     std::cout << "  [Q] 종료\n";
     std::cout << "----------------------------------------------------\n";
 
@@ -223,6 +493,10 @@ int main() {
         case 'B': BugB_FSMStateLeaks(); break;
         case 'C': BugC_MissingVirtualDestructor(); break;
         case 'D': BugD_RepeatedLoadingWithoutCache(); break;
+        case 'E': ShowHeapProfile(); break;
+        case 'F': MeasureProfilerOverhead(); break;
+        case 'G': BenchmarkBatchedRenderers(); break;
+        case 'H': DemoMemoryBudget(); break;
         case 'Q': std::cout << "종료합니다.\n"; return 0;
         default:  std::cout << "잘못된 입력입니다.\n"; break;
         }
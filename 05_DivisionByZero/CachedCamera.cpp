@@ -0,0 +1,168 @@
+/*============================================================================
+ *  CachedCamera.cpp - 뷰/프로젝션 행렬과 절두체 평면 계산
+ *  ---------------------------------------------------------------------------
+ *  절두체 평면은 뷰-프로젝션 행렬의 행에서 바로 뽑습니다 (Gribb-Hartmann):
+ *      left = r3 + r0, right = r3 - r0, bottom = r3 + r1, top = r3 - r1,
+ *      near = r2 (z >= 0),  far = r3 - r2
+ *============================================================================*/
+#include "CachedCamera.h"
+
+#include <cmath>
+
+namespace {
+
+const float kPi = 3.14159265358979f;
+
+Float3 Sub(const Float3& a, const Float3& b) { return { a.x - b.x, a.y - b.y, a.z - b.z }; }
+float  Dot(const Float3& a, const Float3& b) { return a.x * b.x + a.y * b.y + a.z * b.z; }
+
+Float3 Cross(const Float3& a, const Float3& b) {
+    return { a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x };
+}
+
+Float3 Scale(const Float3& v, float s) { return { v.x * s, v.y * s, v.z * s }; }
+
+} // namespace
+
+Matrix4 Matrix4::Identity() {
+    Matrix4 r = {};
+    r.m[0][0] = r.m[1][1] = r.m[2][2] = r.m[3][3] = 1.0f;
+    return r;
+}
+
+Matrix4 Matrix4::operator*(const Matrix4& rhs) const {
+    Matrix4 r;
+    for (int row = 0; row < 4; row++) {
+        for (int col = 0; col < 4; col++) {
+            r.m[row][col] = m[row][0] * rhs.m[0][col] + m[row][1] * rhs.m[1][col] +
+                            m[row][2] * rhs.m[2][col] + m[row][3] * rhs.m[3][col];
+        }
+    }
+    return r;
+}
+
+CachedCamera::CachedCamera()
+    : m_Width(1280), m_Height(720), m_AspectRatio(1280.0f / 720.0f),
+      m_FovY(kPi / 3.0f), m_NearZ(0.1f), m_FarZ(1000.0f),
+      m_Eye{ 0.0f, 0.0f, 0.0f }, m_Target{ 0.0f, 0.0f, 1.0f }, m_Up{ 0.0f, 1.0f, 0.0f },
+      m_Dirty(DirtyView | DirtyProjection),
+      m_View(Matrix4::Identity()), m_Projection(Matrix4::Identity()),
+      m_ViewProjection(Matrix4::Identity()), m_Frustum(),
+      m_ProjectionRebuilds(0), m_ViewProjectionRebuilds(0) {
+}
+
+bool CachedCamera::SetViewport(int width, int height) {
+    if (width <= 0 || height <= 0) return false;
+    if (width == m_Width && height == m_Height) return true;
+
+    m_Width = width;
+    m_Height = height;
+    m_AspectRatio = (float)width / (float)height;   // 나눗셈은 여기서 한 번만
+    m_Dirty |= DirtyProjection;
+    return true;
+}
+
+bool CachedCamera::SetPerspective(float fovYRadians, float nearZ, float farZ) {
+    // !(a < b) 형태는 NaN도 걸러냄
+    if (!(fovYRadians > 0.0f && fovYRadians < kPi)) return false;
+    if (!(nearZ > 0.0f && nearZ < farZ) || std::isinf(farZ)) return false;
+
+    m_FovY = fovYRadians;
+    m_NearZ = nearZ;
+    m_FarZ = farZ;
+    m_Dirty |= DirtyProjection;
+    return true;
+}
+
+bool CachedCamera::SetLookAt(const Float3& eye, const Float3& target, const Float3& up) {
+    Float3 forward = Sub(target, eye);
+    float forwardLenSq = Dot(forward, forward);
+    if (!(forwardLenSq > 1e-12f)) return false;
+
+    Float3 side = Cross(up, forward);
+    if (!(Dot(side, side) > 1e-12f * forwardLenSq)) return false;
+
+    m_Eye = eye;
+    m_Target = target;
+    m_Up = up;
+    m_Dirty |= DirtyView;
+    return true;
+}
+
+const Matrix4& CachedCamera::GetView() const {
+    RebuildIfDirty();
+    return m_View;
+}
+
+const Matrix4& CachedCamera::GetProjection() const {
+    RebuildIfDirty();
+    return m_Projection;
+}
+
+const Matrix4& CachedCamera::GetViewProjection() const {
+    RebuildIfDirty();
+    return m_ViewProjection;
+}
+
+const Frustum& CachedCamera::GetFrustum() const {
+    RebuildIfDirty();
+    return m_Frustum;
+}
+
+void CachedCamera::RebuildIfDirty() const {
+    if (m_Dirty == 0) return;
+
+    if (m_Dirty & DirtyView) {
+        // LookAtLH (Set 시점에 길이가 0이 아님을 확인했음)
+        Float3 zAxis = Sub(m_Target, m_Eye);
+        zAxis = Scale(zAxis, 1.0f / sqrtf(Dot(zAxis, zAxis)));
+        Float3 xAxis = Cross(m_Up, zAxis);
+        xAxis = Scale(xAxis, 1.0f / sqrtf(Dot(xAxis, xAxis)));
+        Float3 yAxis = Cross(zAxis, xAxis);
+
+        const Float3 axes[3] = { xAxis, yAxis, zAxis };
+        m_View = Matrix4::Identity();
+        for (int row = 0; row < 3; row++) {
+            m_View.m[row][0] = axes[row].x;
+            m_View.m[row][1] = axes[row].y;
+            m_View.m[row][2] = axes[row].z;
+            m_View.m[row][3] = -Dot(axes[row], m_Eye);
+        }
+    }
+
+    if (m_Dirty & DirtyProjection) {
+        // PerspectiveFovLH
+        float yScale = 1.0f / tanf(m_FovY * 0.5f);
+        float xScale = yScale / m_AspectRatio;
+        float range = m_FarZ / (m_FarZ - m_NearZ);
+
+        m_Projection = Matrix4();
+        m_Projection.m[0][0] = xScale;
+        m_Projection.m[1][1] = yScale;
+        m_Projection.m[2][2] = range;
+        m_Projection.m[2][3] = -range * m_NearZ;
+        m_Projection.m[3][2] = 1.0f;
+        m_ProjectionRebuilds++;
+    }
+
+    m_ViewProjection = m_Projection * m_View;
+    m_ViewProjectionRebuilds++;
+
+    const float (*r)[4] = m_ViewProjection.m;
+    float planes[Frustum::PlaneCount][4];
+    for (int c = 0; c < 4; c++) {
+        planes[Frustum::Left][c]   = r[3][c] + r[0][c];
+        planes[Frustum::Right][c]  = r[3][c] - r[0][c];
+        planes[Frustum::Bottom][c] = r[3][c] + r[1][c];
+        planes[Frustum::Top][c]    = r[3][c] - r[1][c];
+        planes[Frustum::Near][c]   = r[2][c];
+        planes[Frustum::Far][c]    = r[3][c] - r[2][c];
+    }
+    for (int p = 0; p < Frustum::PlaneCount; p++) {
+        const float* pl = planes[p];
+        float invLen = 1.0f / sqrtf(pl[0] * pl[0] + pl[1] * pl[1] + pl[2] * pl[2]);
+        for (int c = 0; c < 4; c++) m_Frustum.planes[p][c] = pl[c] * invLen;
+    }
+
+    m_Dirty = 0;
+}
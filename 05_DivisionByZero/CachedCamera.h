@@ -0,0 +1,75 @@
+/*============================================================================
+ *  CachedCamera - dirty 플래그로 캐시하는 뷰-프로젝션 행렬
+ *  ---------------------------------------------------------------------------
+ *  Camera::GetAspectRatio()는 호출할 때마다 width / height를 다시 나누고,
+ *  height == 0이면 inf가 됩니다(BUG A).
+ *
+ *  CachedCamera는
+ *  - 뷰포트/FOV/클리핑 값을 Set* 시점에 검사해서 잘못된 값은 거부하고
+ *  - 값이 바뀌면 dirty 플래그만 세운 뒤
+ *  - 행렬/절두체를 요청받았을 때 dirty인 부분만 다시 계산합니다.
+ *
+ *  좌표계는 Direct3D 기준입니다 (왼손 좌표계, 클립 공간 z = 0 ~ 1, 열 벡터: clip = VP * p).
+ *============================================================================*/
+#pragma once
+
+#include "FrustumCulling.h"
+
+struct Float3 {
+    float x, y, z;
+};
+
+// m[row][col], 열 벡터 규약 (v' = M * v)
+struct Matrix4 {
+    float m[4][4];
+
+    static Matrix4 Identity();
+    Matrix4 operator*(const Matrix4& rhs) const;
+};
+
+class CachedCamera {
+public:
+    CachedCamera();
+
+    // width, height > 0 이어야 함. 잘못된 값이면 기존 값을 유지하고 false
+    bool SetViewport(int width, int height);
+
+    // 0 < fovY < π, 0 < nearZ < farZ
+    bool SetPerspective(float fovYRadians, float nearZ, float farZ);
+
+    // eye == target 이거나 up이 시선과 평행하면 false
+    bool SetLookAt(const Float3& eye, const Float3& target, const Float3& up);
+
+    float GetAspectRatio() const { return m_AspectRatio; }
+
+    const Matrix4& GetView() const;
+    const Matrix4& GetProjection() const;
+    const Matrix4& GetViewProjection() const;
+    const Frustum& GetFrustum() const;
+
+    // 실제로 다시 계산한 횟수 (캐시 확인용)
+    int GetProjectionRebuildCount() const { return m_ProjectionRebuilds; }
+    int GetViewProjectionRebuildCount() const { return m_ViewProjectionRebuilds; }
+
+private:
+    void RebuildIfDirty() const;
+
+    enum DirtyFlags {
+        DirtyView       = 1 << 0,
+        DirtyProjection = 1 << 1,
+    };
+
+    int    m_Width, m_Height;
+    float  m_AspectRatio;
+    float  m_FovY, m_NearZ, m_FarZ;
+    Float3 m_Eye, m_Target, m_Up;
+
+    // 캐시 (const 조회 함수에서 갱신)
+    mutable int     m_Dirty;
+    mutable Matrix4 m_View;
+    mutable Matrix4 m_Projection;
+    mutable Matrix4 m_ViewProjection;
+    mutable Frustum m_Frustum;
+    mutable int     m_ProjectionRebuilds;
+    mutable int     m_ViewProjectionRebuilds;
+};
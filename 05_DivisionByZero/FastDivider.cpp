@@ -0,0 +1,243 @@
+/*============================================================================
+ *  FastDivider.cpp - 매직 넘버 계산과 Scalar / SSE4.1 / AVX2 일괄 나눗셈
+ *  ---------------------------------------------------------------------------
+ *  매직 넘버 계산은 Granlund-Montgomery 방식입니다 (Hacker's Delight 10장).
+ *  l = floor(log2(|d|))일 때 m ≈ 2^(32+l) / d를 올림해서 구하고,
+ *  올림 오차가 너무 크면 한 비트 더 정밀한 m(33비트)과 덧셈 보정을 씁니다.
+ *
+ *  SIMD에는 32비트 곱셈 상위 절반 명령어가 없으므로
+ *  짝수/홀수 레인을 64비트 곱셈(mul_epu32 / mul_epi32)으로 나눠 계산한 뒤 합칩니다.
+ *============================================================================*/
+#include "FastDivider.h"
+#include "SimdDispatch.h"
+
+#include <stdexcept>
+
+namespace {
+
+int FloorLog2(uint32_t v) {
+    int l = 0;
+    while (v >>= 1) l++;
+    return l;
+}
+
+// ============================================================================
+// SIMD 보조 함수: 32비트 레인별 곱셈 상위 절반 (m은 모든 레인이 같은 값)
+// ============================================================================
+SIMD_TARGET_SSE41
+inline __m128i MulHiU32(__m128i a, __m128i m) {
+    __m128i even = _mm_srli_epi64(_mm_mul_epu32(a, m), 32);
+    __m128i odd = _mm_mul_epu32(_mm_srli_epi64(a, 32), m);
+    return _mm_blend_epi16(even, odd, 0xCC);
+}
+
+SIMD_TARGET_SSE41
+inline __m128i MulHiS32(__m128i a, __m128i m) {
+    __m128i even = _mm_srli_epi64(_mm_mul_epi32(a, m), 32);
+    __m128i odd = _mm_mul_epi32(_mm_srli_epi64(a, 32), m);
+    return _mm_blend_epi16(even, odd, 0xCC);
+}
+
+SIMD_TARGET_AVX2
+inline __m256i MulHiU32(__m256i a, __m256i m) {
+    __m256i even = _mm256_srli_epi64(_mm256_mul_epu32(a, m), 32);
+    __m256i odd = _mm256_mul_epu32(_mm256_srli_epi64(a, 32), m);
+    return _mm256_blend_epi32(even, odd, 0xAA);
+}
+
+SIMD_TARGET_AVX2
+inline __m256i MulHiS32(__m256i a, __m256i m) {
+    __m256i even = _mm256_srli_epi64(_mm256_mul_epi32(a, m), 32);
+    __m256i odd = _mm256_mul_epi32(_mm256_srli_epi64(a, 32), m);
+    return _mm256_blend_epi32(even, odd, 0xAA);
+}
+
+// ============================================================================
+// 부호 없는 커널 (path: 0 = Shift, 1 = MulShift, 2 = MulAddShift)
+// ============================================================================
+SIMD_TARGET_SSE41
+size_t DivideU32SSE(const uint32_t* in, uint32_t* out, size_t n,
+                    uint32_t magic, uint32_t shift, int path) {
+    const __m128i vm = _mm_set1_epi32((int)magic);
+    const __m128i vs = _mm_cvtsi32_si128((int)shift);
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+        __m128i q;
+        if (path == 0) {
+            q = _mm_srl_epi32(v, vs);
+        } else if (path == 1) {
+            q = _mm_srl_epi32(MulHiU32(v, vm), vs);
+        } else {
+            __m128i hi = MulHiU32(v, vm);
+            __m128i t = _mm_add_epi32(_mm_srli_epi32(_mm_sub_epi32(v, hi), 1), hi);
+            q = _mm_srl_epi32(t, vs);
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), q);
+    }
+    return i;
+}
+
+SIMD_TARGET_AVX2
+size_t DivideU32AVX2(const uint32_t* in, uint32_t* out, size_t n,
+                     uint32_t magic, uint32_t shift, int path) {
+    const __m256i vm = _mm256_set1_epi32((int)magic);
+    const __m128i vs = _mm_cvtsi32_si128((int)shift);
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i));
+        __m256i q;
+        if (path == 0) {
+            q = _mm256_srl_epi32(v, vs);
+        } else if (path == 1) {
+            q = _mm256_srl_epi32(MulHiU32(v, vm), vs);
+        } else {
+            __m256i hi = MulHiU32(v, vm);
+            __m256i t = _mm256_add_epi32(_mm256_srli_epi32(_mm256_sub_epi32(v, hi), 1), hi);
+            q = _mm256_srl_epi32(t, vs);
+        }
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), q);
+    }
+    return i;
+}
+
+// ============================================================================
+// 부호 있는 커널 (magic == 0: |d|가 2의 거듭제곱)
+// ============================================================================
+SIMD_TARGET_SSE41
+size_t DivideS32SSE(const int32_t* in, int32_t* out, size_t n,
+                    int32_t magic, uint32_t shift, bool add, bool negative) {
+    const __m128i vm = _mm_set1_epi32(magic);
+    const __m128i vs = _mm_cvtsi32_si128((int)shift);
+    const __m128i sign = _mm_set1_epi32(negative ? -1 : 0);
+    const __m128i bias = _mm_set1_epi32((int)((1u << shift) - 1));
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+        __m128i q;
+        if (magic == 0) {
+            __m128i biased = _mm_add_epi32(v, _mm_and_si128(_mm_srai_epi32(v, 31), bias));
+            q = _mm_sra_epi32(biased, vs);
+            q = _mm_sub_epi32(_mm_xor_si128(q, sign), sign);
+        } else {
+            q = MulHiS32(v, vm);
+            if (add) q = _mm_add_epi32(q, _mm_sub_epi32(_mm_xor_si128(v, sign), sign));
+            q = _mm_sra_epi32(q, vs);
+            q = _mm_add_epi32(q, _mm_srli_epi32(q, 31));
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), q);
+    }
+    return i;
+}
+
+SIMD_TARGET_AVX2
+size_t DivideS32AVX2(const int32_t* in, int32_t* out, size_t n,
+                     int32_t magic, uint32_t shift, bool add, bool negative) {
+    const __m256i vm = _mm256_set1_epi32(magic);
+    const __m128i vs = _mm_cvtsi32_si128((int)shift);
+    const __m256i sign = _mm256_set1_epi32(negative ? -1 : 0);
+    const __m256i bias = _mm256_set1_epi32((int)((1u << shift) - 1));
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i));
+        __m256i q;
+        if (magic == 0) {
+            __m256i biased = _mm256_add_epi32(v, _mm256_and_si256(_mm256_srai_epi32(v, 31), bias));
+            q = _mm256_sra_epi32(biased, vs);
+            q = _mm256_sub_epi32(_mm256_xor_si256(q, sign), sign);
+        } else {
+            q = MulHiS32(v, vm);
+            if (add) q = _mm256_add_epi32(q, _mm256_sub_epi32(_mm256_xor_si256(v, sign), sign));
+            q = _mm256_sra_epi32(q, vs);
+            q = _mm256_add_epi32(q, _mm256_srli_epi32(q, 31));
+        }
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), q);
+    }
+    return i;
+}
+
+} // namespace
+
+// ============================================================================
+// FastDivider<uint32_t>
+// ============================================================================
+FastDivider<uint32_t>::FastDivider(uint32_t divisor)
+    : m_Divisor(divisor), m_Magic(0), m_Shift(0), m_Path(Path::Shift) {
+    if (divisor == 0) throw std::invalid_argument("FastDivider: divisor is zero");
+
+    int l = FloorLog2(divisor);
+    m_Shift = (uint32_t)l;
+    if ((divisor & (divisor - 1)) == 0) return;   // 2^l
+
+    // 2^(32+l) / d는 d > 2^l 이므로 32비트에 들어감
+    uint64_t numerator = 1ull << (32 + l);
+    uint32_t proposed = (uint32_t)(numerator / divisor);
+    uint32_t rem = (uint32_t)(numerator % divisor);
+
+    if (divisor - rem < (1u << l)) {
+        m_Path = Path::MulShift;
+    } else {
+        // 한 비트 더 정밀하게: m = 2^32 + (2 * proposed + 보정)
+        proposed += proposed;
+        uint32_t twiceRem = rem + rem;
+        if (twiceRem >= divisor || twiceRem < rem) proposed += 1;
+        m_Path = Path::MulAddShift;
+    }
+    m_Magic = proposed + 1;
+}
+
+void FastDivider<uint32_t>::DivideBatch(const uint32_t* in, uint32_t* out, size_t count) const {
+    int path = (int)m_Path;
+    size_t done = 0;
+    switch (GetSimdLevel()) {
+    case SimdLevel::AVX2:  done = DivideU32AVX2(in, out, count, m_Magic, m_Shift, path); break;
+    case SimdLevel::SSE41: done = DivideU32SSE(in, out, count, m_Magic, m_Shift, path); break;
+    default: break;
+    }
+    for (size_t i = done; i < count; i++) out[i] = Divide(in[i]);
+}
+
+// ============================================================================
+// FastDivider<int32_t>
+// ============================================================================
+FastDivider<int32_t>::FastDivider(int32_t divisor)
+    : m_Divisor(divisor), m_Magic(0), m_Shift(0), m_Add(false), m_Negative(divisor < 0) {
+    if (divisor == 0) throw std::invalid_argument("FastDivider: divisor is zero");
+
+    // INT32_MIN도 표현되도록 부호 없는 값으로 절댓값 계산
+    uint32_t absD = m_Negative ? 0u - (uint32_t)divisor : (uint32_t)divisor;
+    int l = FloorLog2(absD);
+    m_Shift = (uint32_t)l;
+    if ((absD & (absD - 1)) == 0) return;   // |d| = 2^l
+
+    // |d| >= 3 이므로 l >= 1
+    uint64_t numerator = 1ull << (31 + l);
+    uint32_t proposed = (uint32_t)(numerator / absD);
+    uint32_t rem = (uint32_t)(numerator % absD);
+
+    if (absD - rem < (1u << l)) {
+        m_Shift = (uint32_t)(l - 1);
+    } else {
+        proposed += proposed;
+        uint32_t twiceRem = rem + rem;
+        if (twiceRem >= absD || twiceRem < rem) proposed += 1;
+        m_Add = true;
+    }
+    proposed += 1;
+    m_Magic = (int32_t)(m_Negative ? 0u - proposed : proposed);
+}
+
+void FastDivider<int32_t>::DivideBatch(const int32_t* in, int32_t* out, size_t count) const {
+    size_t done = 0;
+    switch (GetSimdLevel()) {
+    case SimdLevel::AVX2:
+        done = DivideS32AVX2(in, out, count, m_Magic, m_Shift, m_Add, m_Negative);
+        break;
+    case SimdLevel::SSE41:
+        done = DivideS32SSE(in, out, count, m_Magic, m_Shift, m_Add, m_Negative);
+        break;
+    default:
+        break;
+    }
+    for (size_t i = done; i < count; i++) out[i] = Divide(in[i]);
+}
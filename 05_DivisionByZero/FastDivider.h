@@ -0,0 +1,129 @@
+/*============================================================================
+ *  FastDivider - 같은 정수로 여러 번 나눌 때 쓰는 곱셈 기반 나눗셈
+ *  ---------------------------------------------------------------------------
+ *  정수 나눗셈(div/idiv)은 수십 사이클이 걸리고 SIMD 명령어도 없습니다.
+ *  제수(divisor)가 실행 중에 한 번 정해지고 여러 값을 나눈다면
+ *  "매직 넘버" m과 시프트 s를 미리 구해 두고 곱셈 상위 32비트 + 시프트로 바꿀 수 있습니다.
+ *
+ *      n / d  ==  mulhi(n, m) >> s       (필요하면 덧셈 보정 1회)
+ *
+ *  - 생성자에서 제수 0을 거부합니다 (std::invalid_argument).
+ *    따라서 Divide()에는 0 검사가 없고, 하드웨어 예외(BUG B)가 날 수 없습니다.
+ *  - 결과는 C++ '/'와 같습니다 (부호 있는 나눗셈은 0 방향으로 버림).
+ *  - 예외: INT32_MIN / -1은 오버플로이므로 INT32_MIN을 돌려줍니다
+ *    (하드웨어 idiv는 이 경우 크래시).
+ *  - DivideBatch는 SimdDispatch로 AVX2/SSE4.1/Scalar 커널을 고릅니다.
+ *
+ *  지원 타입: uint32_t, int32_t
+ *
+ *  [사용법]
+ *      FastDivider<int32_t> perTeam(teamCount);   // teamCount == 0이면 여기서 예외
+ *      for (...) enemiesPerTeam[i] = totalEnemies[i] / perTeam;
+ *============================================================================*/
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+template <typename T>
+class FastDivider;   // uint32_t, int32_t 특수화만 있음
+
+namespace FastDividerDetail {
+
+inline uint32_t MulHi(uint32_t a, uint32_t b) {
+    return (uint32_t)(((uint64_t)a * b) >> 32);
+}
+
+inline int32_t MulHi(int32_t a, int32_t b) {
+    return (int32_t)(((int64_t)a * b) >> 32);
+}
+
+} // namespace FastDividerDetail
+
+// ============================================================================
+// 부호 없는 32비트
+// ============================================================================
+template <>
+class FastDivider<uint32_t> {
+public:
+    explicit FastDivider(uint32_t divisor);
+
+    uint32_t Divisor() const { return m_Divisor; }
+
+    uint32_t Divide(uint32_t n) const {
+        switch (m_Path) {
+        case Path::Shift:
+            return n >> m_Shift;
+        case Path::MulShift:
+            return FastDividerDetail::MulHi(n, m_Magic) >> m_Shift;
+        default: {
+            uint32_t q = FastDividerDetail::MulHi(n, m_Magic);
+            return (((n - q) >> 1) + q) >> m_Shift;
+        }
+        }
+    }
+
+    uint32_t Remainder(uint32_t n) const { return n - Divide(n) * m_Divisor; }
+
+    // out[i] = in[i] / divisor. in과 out은 같은 배열이어도 됨
+    void DivideBatch(const uint32_t* in, uint32_t* out, size_t count) const;
+
+private:
+    enum class Path : uint8_t {
+        Shift,          // 2의 거듭제곱
+        MulShift,       // mulhi >> s
+        MulAddShift,    // 매직 넘버가 33비트 필요한 경우: ((n - q) / 2 + q) >> s
+    };
+
+    uint32_t m_Divisor;
+    uint32_t m_Magic;
+    uint32_t m_Shift;
+    Path     m_Path;
+};
+
+inline uint32_t operator/(uint32_t n, const FastDivider<uint32_t>& divider) {
+    return divider.Divide(n);
+}
+
+// ============================================================================
+// 부호 있는 32비트
+// ============================================================================
+template <>
+class FastDivider<int32_t> {
+public:
+    explicit FastDivider(int32_t divisor);
+
+    int32_t Divisor() const { return m_Divisor; }
+
+    int32_t Divide(int32_t n) const {
+        // 오버플로가 정의된 부호 없는 연산으로 더하고 뺌
+        uint32_t sign = m_Negative ? 0xFFFFFFFFu : 0u;
+        if (m_Magic == 0) {
+            // |d| = 2^s: 음수는 (2^s - 1)을 더해야 0 방향으로 버림
+            uint32_t bias = (uint32_t)(n >> 31) & ((1u << m_Shift) - 1);
+            uint32_t q = (uint32_t)((int32_t)((uint32_t)n + bias) >> m_Shift);
+            return (int32_t)((q ^ sign) - sign);
+        }
+        uint32_t q = (uint32_t)FastDividerDetail::MulHi(n, m_Magic);
+        if (m_Add) q += ((uint32_t)n ^ sign) - sign;
+        q = (uint32_t)((int32_t)q >> m_Shift);
+        return (int32_t)(q + (q >> 31));   // 음수 몫은 +1 (0 방향 버림)
+    }
+
+    int32_t Remainder(int32_t n) const {
+        return (int32_t)((uint32_t)n - (uint32_t)Divide(n) * (uint32_t)m_Divisor);
+    }
+
+    void DivideBatch(const int32_t* in, int32_t* out, size_t count) const;
+
+private:
+    int32_t  m_Divisor;
+    int32_t  m_Magic;       // 0이면 |d|가 2의 거듭제곱
+    uint32_t m_Shift;
+    bool     m_Add;         // mulhi 결과에 ±n 보정
+    bool     m_Negative;    // 제수가 음수
+};
+
+inline int32_t operator/(int32_t n, const FastDivider<int32_t>& divider) {
+    return divider.Divide(n);
+}
@@ -0,0 +1,118 @@
+/*============================================================================
+ *  FiniteValidator.cpp - Scalar / SSE4.1 / AVX2 검사 커널
+ *  ---------------------------------------------------------------------------
+ *  빠른 경로는 "이 블록에 inf/NaN이 하나라도 있는가"만 봅니다.
+ *  하나라도 있으면 그 블록만 Scalar로 다시 훑어서 정확한 인덱스를 찾습니다.
+ *============================================================================*/
+#include "FiniteValidator.h"
+#include "SimdDispatch.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+namespace {
+
+const uint32_t kExponentMask = 0x7F800000u;
+
+// ============================================================================
+// Scalar
+// ============================================================================
+size_t FindFirstNonFiniteScalar(const float* data, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        uint32_t bits;
+        memcpy(&bits, &data[i], sizeof(bits));
+        if ((bits & kExponentMask) == kExponentMask) return i;
+    }
+    return n;
+}
+
+// ============================================================================
+// SSE4.1 (16개씩 묶어서 분기 1회)
+// ============================================================================
+SIMD_TARGET_SSE41
+size_t FindFirstNonFiniteSSE(const float* data, size_t n) {
+    const __m128i mask = _mm_set1_epi32((int)kExponentMask);
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        const __m128i* p = reinterpret_cast<const __m128i*>(data + i);
+        __m128i m0 = _mm_cmpeq_epi32(_mm_and_si128(_mm_loadu_si128(p + 0), mask), mask);
+        __m128i m1 = _mm_cmpeq_epi32(_mm_and_si128(_mm_loadu_si128(p + 1), mask), mask);
+        __m128i m2 = _mm_cmpeq_epi32(_mm_and_si128(_mm_loadu_si128(p + 2), mask), mask);
+        __m128i m3 = _mm_cmpeq_epi32(_mm_and_si128(_mm_loadu_si128(p + 3), mask), mask);
+        __m128i any = _mm_or_si128(_mm_or_si128(m0, m1), _mm_or_si128(m2, m3));
+        if (!_mm_testz_si128(any, any)) {
+            return i + FindFirstNonFiniteScalar(data + i, 16);
+        }
+    }
+    return i + FindFirstNonFiniteScalar(data + i, n - i);
+}
+
+// ============================================================================
+// AVX2 (32개씩 묶어서 분기 1회)
+// ============================================================================
+SIMD_TARGET_AVX2
+size_t FindFirstNonFiniteAVX2(const float* data, size_t n) {
+    const __m256i mask = _mm256_set1_epi32((int)kExponentMask);
+    size_t i = 0;
+    for (; i + 32 <= n; i += 32) {
+        const __m256i* p = reinterpret_cast<const __m256i*>(data + i);
+        __m256i m0 = _mm256_cmpeq_epi32(_mm256_and_si256(_mm256_loadu_si256(p + 0), mask), mask);
+        __m256i m1 = _mm256_cmpeq_epi32(_mm256_and_si256(_mm256_loadu_si256(p + 1), mask), mask);
+        __m256i m2 = _mm256_cmpeq_epi32(_mm256_and_si256(_mm256_loadu_si256(p + 2), mask), mask);
+        __m256i m3 = _mm256_cmpeq_epi32(_mm256_and_si256(_mm256_loadu_si256(p + 3), mask), mask);
+        __m256i any = _mm256_or_si256(_mm256_or_si256(m0, m1), _mm256_or_si256(m2, m3));
+        if (!_mm256_testz_si256(any, any)) {
+            return i + FindFirstNonFiniteScalar(data + i, 32);
+        }
+    }
+    return i + FindFirstNonFiniteScalar(data + i, n - i);
+}
+
+} // namespace
+
+size_t FindFirstNonFinite(const float* data, size_t count) {
+    switch (GetSimdLevel()) {
+    case SimdLevel::AVX2:  return FindFirstNonFiniteAVX2(data, count);
+    case SimdLevel::SSE41: return FindFirstNonFiniteSSE(data, count);
+    default:               return FindFirstNonFiniteScalar(data, count);
+    }
+}
+
+void FiniteValidator::Watch(const Vector3Batch* batch, const char* name) {
+    m_Buffers.push_back({ batch, name });
+}
+
+bool FiniteValidator::Validate(NonFiniteReport* report) const {
+    bool found = false;
+    NonFiniteReport first;
+
+    for (const Entry& entry : m_Buffers) {
+        const float* components[3] = { entry.batch->X(), entry.batch->Y(), entry.batch->Z() };
+        for (int c = 0; c < 3; c++) {
+            // 이미 찾은 엔티티보다 앞쪽만 검사하면 됨 (같은 엔티티는 먼저 찾은 쪽 우선)
+            // 버퍼마다 크기가 다를 수 있으므로 이 버퍼의 크기를 넘지 않게
+            size_t limit = entry.batch->Size();
+            if (found) limit = std::min(limit, first.entity);
+            size_t index = FindFirstNonFinite(components[c], limit);
+            if (index < limit) {
+                found = true;
+                first.bufferName = entry.name;
+                first.entity = index;
+                first.component = c;
+                first.value = components[c][index];
+            }
+        }
+    }
+
+    if (found && report) *report = first;
+    return !found;
+}
+
+size_t FiniteValidator::BytesPerValidate() const {
+    size_t bytes = 0;
+    for (const Entry& entry : m_Buffers) {
+        bytes += entry.batch->Size() * 3 * sizeof(float);
+    }
+    return bytes;
+}
@@ -0,0 +1,58 @@
+/*============================================================================
+ *  FiniteValidator - 프레임 끝 inf/NaN 검사
+ *  ---------------------------------------------------------------------------
+ *  BUG C/D처럼 NaN/inf는 생긴 프레임이 아니라 오브젝트가 사라진 뒤에야 눈에 띕니다.
+ *  매 프레임 끝에 위치/속도 배열 전체를 훑어서 처음 오염된 엔티티를 바로 찾아냅니다.
+ *
+ *  float의 지수 비트가 전부 1이면 inf 또는 NaN입니다:
+ *      (bits & 0x7F800000) == 0x7F800000
+ *  SIMD로 AND + 정수 비교를 하고, 여러 레지스터의 마스크를 OR로 모아서
+ *  32개(AVX2)마다 분기 한 번만 합니다. 모두 유한하면 메모리를 한 번 읽는 비용이므로
+ *  릴리스 빌드에서도 켜 둘 수 있습니다.
+ *
+ *  [사용법]
+ *      FiniteValidator validator;
+ *      validator.Watch(&positions, "position");
+ *      validator.Watch(&velocities, "velocity");
+ *      ...
+ *      NonFiniteReport report;
+ *      if (!validator.Validate(&report)) { report 출력 후 중단/복구 }
+ *============================================================================*/
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "Vector3Batch.h"
+
+// 처음 발견된 inf/NaN 위치
+struct NonFiniteReport {
+    const char* bufferName = nullptr;
+    size_t      entity     = 0;
+    int         component  = 0;     // 0 = x, 1 = y, 2 = z
+    float       value      = 0.0f;
+};
+
+// data[0, count)에서 처음 나오는 inf/NaN의 인덱스. 모두 유한하면 count
+size_t FindFirstNonFinite(const float* data, size_t count);
+
+class FiniteValidator {
+public:
+    // batch는 Validate() 호출 시점에 살아 있어야 합니다 (크기는 매번 다시 읽음)
+    void Watch(const Vector3Batch* batch, const char* name);
+    void Clear() { m_Buffers.clear(); }
+
+    // 모두 유한하면 true. 아니면 가장 작은 엔티티 번호의 오염을 report에 기록
+    // (같은 엔티티면 Watch 순서 → x, y, z 순서)
+    bool Validate(NonFiniteReport* report = nullptr) const;
+
+    // 검사에서 읽는 바이트 수 (대역폭 계산용)
+    size_t BytesPerValidate() const;
+
+private:
+    struct Entry {
+        const Vector3Batch* batch;
+        const char*         name;
+    };
+    std::vector<Entry> m_Buffers;
+};
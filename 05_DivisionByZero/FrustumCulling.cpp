@@ -0,0 +1,150 @@
+/*============================================================================
+ *  FrustumCulling.cpp - Scalar / SSE4.1 / AVX2 컬링 커널
+ *  ---------------------------------------------------------------------------
+ *  평면 거리는 모든 커널에서 (a*x + b*y) + c*z + d 순서로 계산합니다.
+ *============================================================================*/
+#include "FrustumCulling.h"
+#include "SimdDispatch.h"
+
+#include <cassert>
+#include <cstring>
+
+namespace {
+
+// g_CompactLut[mask][k] = mask에서 k번째로 켜진 비트의 위치
+struct CompactLut {
+    uint8_t lanes[256][8];
+
+    CompactLut() {
+        for (int mask = 0; mask < 256; mask++) {
+            int k = 0;
+            for (int bit = 0; bit < 8; bit++) {
+                if (mask & (1 << bit)) lanes[mask][k++] = (uint8_t)bit;
+            }
+            for (; k < 8; k++) lanes[mask][k] = 0;
+        }
+    }
+};
+
+const CompactLut g_CompactLut;
+
+inline int PopCount8(int mask) {
+    int count = 0;
+    for (; mask; mask &= mask - 1) count++;
+    return count;
+}
+
+// ============================================================================
+// Scalar
+// ============================================================================
+size_t CullScalar(const Frustum& f, const float* x, const float* y, const float* z,
+                  const float* r, size_t begin, size_t n, uint32_t* out, size_t count) {
+    for (size_t i = begin; i < n; i++) {
+        bool visible = true;
+        for (int p = 0; p < Frustum::PlaneCount; p++) {
+            const float* pl = f.planes[p];
+            float dist = (pl[0] * x[i] + pl[1] * y[i]) + pl[2] * z[i] + pl[3];
+            visible = visible && (dist >= -r[i]);
+        }
+        out[count] = (uint32_t)i;
+        count += visible ? 1 : 0;
+    }
+    return count;
+}
+
+// ============================================================================
+// SSE4.1 (4개씩)
+// ============================================================================
+SIMD_TARGET_SSE41
+size_t CullSSE(const Frustum& f, const float* x, const float* y, const float* z,
+               const float* r, size_t n, uint32_t* out) {
+    __m128 pa[6], pb[6], pc[6], pd[6];
+    for (int p = 0; p < 6; p++) {
+        pa[p] = _mm_set1_ps(f.planes[p][0]);
+        pb[p] = _mm_set1_ps(f.planes[p][1]);
+        pc[p] = _mm_set1_ps(f.planes[p][2]);
+        pd[p] = _mm_set1_ps(f.planes[p][3]);
+    }
+    const __m128 signBit = _mm_set1_ps(-0.0f);
+
+    size_t count = 0, i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128 vx = _mm_loadu_ps(x + i);
+        __m128 vy = _mm_loadu_ps(y + i);
+        __m128 vz = _mm_loadu_ps(z + i);
+        __m128 negR = _mm_xor_ps(_mm_loadu_ps(r + i), signBit);
+        __m128 inside = _mm_castsi128_ps(_mm_set1_epi32(-1));
+        for (int p = 0; p < 6; p++) {
+            __m128 dist = _mm_add_ps(
+                _mm_add_ps(_mm_add_ps(_mm_mul_ps(pa[p], vx), _mm_mul_ps(pb[p], vy)),
+                           _mm_mul_ps(pc[p], vz)), pd[p]);
+            inside = _mm_and_ps(inside, _mm_cmpge_ps(dist, negR));
+        }
+        int mask = _mm_movemask_ps(inside);
+
+        // 보이는 레인 번호(룩업) + 묶음 시작 인덱스를 한 번에 저장
+        int packedLanes;
+        memcpy(&packedLanes, g_CompactLut.lanes[mask], sizeof(packedLanes));
+        __m128i lanes = _mm_cvtepu8_epi32(_mm_cvtsi32_si128(packedLanes));
+        __m128i indices = _mm_add_epi32(lanes, _mm_set1_epi32((int)i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + count), indices);
+        count += PopCount8(mask);
+    }
+    return CullScalar(f, x, y, z, r, i, n, out, count);
+}
+
+// ============================================================================
+// AVX2 (8개씩)
+// ============================================================================
+SIMD_TARGET_AVX2
+size_t CullAVX2(const Frustum& f, const float* x, const float* y, const float* z,
+                const float* r, size_t n, uint32_t* out) {
+    __m256 pa[6], pb[6], pc[6], pd[6];
+    for (int p = 0; p < 6; p++) {
+        pa[p] = _mm256_set1_ps(f.planes[p][0]);
+        pb[p] = _mm256_set1_ps(f.planes[p][1]);
+        pc[p] = _mm256_set1_ps(f.planes[p][2]);
+        pd[p] = _mm256_set1_ps(f.planes[p][3]);
+    }
+    const __m256 signBit = _mm256_set1_ps(-0.0f);
+
+    size_t count = 0, i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256 vx = _mm256_loadu_ps(x + i);
+        __m256 vy = _mm256_loadu_ps(y + i);
+        __m256 vz = _mm256_loadu_ps(z + i);
+        __m256 negR = _mm256_xor_ps(_mm256_loadu_ps(r + i), signBit);
+        __m256 inside = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+        for (int p = 0; p < 6; p++) {
+            __m256 dist = _mm256_add_ps(
+                _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(pa[p], vx), _mm256_mul_ps(pb[p], vy)),
+                              _mm256_mul_ps(pc[p], vz)), pd[p]);
+            inside = _mm256_and_ps(inside, _mm256_cmp_ps(dist, negR, _CMP_GE_OQ));
+        }
+        int mask = _mm256_movemask_ps(inside);
+
+        __m256i lanes = _mm256_cvtepu8_epi32(
+            _mm_loadl_epi64(reinterpret_cast<const __m128i*>(g_CompactLut.lanes[mask])));
+        __m256i indices = _mm256_add_epi32(lanes, _mm256_set1_epi32((int)i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + count), indices);
+        count += PopCount8(mask);
+    }
+    return CullScalar(f, x, y, z, r, i, n, out, count);
+}
+
+} // namespace
+
+size_t CullSpheres(const Frustum& frustum, const Vector3Batch& centers, const float* radii,
+                   uint32_t* visibleOut) {
+    size_t n = centers.Size();
+    assert(n <= UINT32_MAX);
+    switch (GetSimdLevel()) {
+    case SimdLevel::AVX2:
+        return CullAVX2(frustum, centers.X(), centers.Y(), centers.Z(), radii, n, visibleOut);
+    case SimdLevel::SSE41:
+        return CullSSE(frustum, centers.X(), centers.Y(), centers.Z(), radii, n, visibleOut);
+    default:
+        return CullScalar(frustum, centers.X(), centers.Y(), centers.Z(), radii, 0, n,
+                          visibleOut, 0);
+    }
+}
@@ -0,0 +1,30 @@
+/*============================================================================
+ *  FrustumCulling - 바운딩 구 일괄 절두체 컬링
+ *  ---------------------------------------------------------------------------
+ *  구의 중심(SoA)과 반지름 배열을 절두체 6개 평면과 비교해서
+ *  보이는 구의 인덱스만 빈틈없이(compacted) 출력 배열에 씁니다.
+ *
+ *      보임: 모든 평면에서 dot(n, center) + d >= -radius
+ *
+ *  SIMD 커널은 레인 마스크(movemask)로 룩업 테이블을 찾아
+ *  보이는 레인의 인덱스를 분기 없이 한 번에 저장합니다.
+ *  (i번째 묶음까지의 출력 개수는 항상 i 이하이므로 출력 배열은 count개면 충분)
+ *
+ *  커널은 SimdDispatch로 선택되며 세 커널의 결과는 같습니다 (FMA 미사용).
+ *============================================================================*/
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "Vector3Batch.h"
+
+// 평면: a*x + b*y + c*z + d = 0, (a, b, c)는 안쪽을 향하는 단위 법선
+struct Frustum {
+    enum Plane { Left, Right, Bottom, Top, Near, Far, PlaneCount };
+    float planes[PlaneCount][4];
+};
+
+// visibleOut에는 centers.Size()개 이상의 공간이 있어야 합니다. 반환값은 보이는 구의 수
+size_t CullSpheres(const Frustum& frustum, const Vector3Batch& centers, const float* radii,
+                   uint32_t* visibleOut);
@@ -0,0 +1,136 @@
+/*============================================================================
+ *  InvSqrt.cpp - Scalar / SSE4.1 / AVX2 커널
+ *  ---------------------------------------------------------------------------
+ *  단일 값 버전도 _ss intrinsic으로 계산해서 배치 커널과 같은 명령어를 씁니다.
+ *  (컴파일러가 식을 재배치하거나 FMA로 합치지 못하게 하기 위함)
+ *
+ *  Newton-Raphson 1회: y1 = y0 * (1.5 - (0.5 * x) * (y0 * y0))
+ *  rsqrt 근사의 상대 오차 e가 약 1.5 × e² 로 줄어듭니다 (3.7e-4 → 약 2e-7 + 반올림 오차).
+ *============================================================================*/
+#include "InvSqrt.h"
+#include "SimdDispatch.h"
+
+namespace {
+
+// ============================================================================
+// Scalar (x64에서는 SSE가 기본이므로 _ss 명령어로 계산)
+// ============================================================================
+inline float InvSqrtOne(float x, InvSqrtMode mode, float minValue) {
+    // maxss: x가 NaN이면 두 번째 피연산자(minValue)를 돌려줌
+    __m128 v = _mm_max_ss(_mm_set_ss(x), _mm_set_ss(minValue));
+    __m128 y;
+    switch (mode) {
+    case InvSqrtMode::Approx:
+        y = _mm_rsqrt_ss(v);
+        break;
+    case InvSqrtMode::Fast: {
+        __m128 y0 = _mm_rsqrt_ss(v);
+        __m128 halfX = _mm_mul_ss(_mm_set_ss(0.5f), v);
+        __m128 t = _mm_mul_ss(halfX, _mm_mul_ss(y0, y0));
+        y = _mm_mul_ss(y0, _mm_sub_ss(_mm_set_ss(1.5f), t));
+        break;
+    }
+    default:
+        y = _mm_div_ss(_mm_set_ss(1.0f), _mm_sqrt_ss(v));
+        break;
+    }
+    return _mm_cvtss_f32(y);
+}
+
+void InvSqrtScalar(const float* in, float* out, size_t n, InvSqrtMode mode, float minValue) {
+    for (size_t i = 0; i < n; i++) {
+        out[i] = InvSqrtOne(in[i], mode, minValue);
+    }
+}
+
+// ============================================================================
+// SSE4.1 (4개씩)
+// ============================================================================
+SIMD_TARGET_SSE41
+void InvSqrtSSE(const float* in, float* out, size_t n, InvSqrtMode mode, float minValue) {
+    const __m128 vmin = _mm_set1_ps(minValue);
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 half = _mm_set1_ps(0.5f);
+    const __m128 threeHalves = _mm_set1_ps(1.5f);
+    size_t i = 0;
+    switch (mode) {
+    case InvSqrtMode::Approx:
+        for (; i + 4 <= n; i += 4) {
+            __m128 v = _mm_max_ps(_mm_loadu_ps(in + i), vmin);
+            _mm_storeu_ps(out + i, _mm_rsqrt_ps(v));
+        }
+        break;
+    case InvSqrtMode::Fast:
+        for (; i + 4 <= n; i += 4) {
+            __m128 v = _mm_max_ps(_mm_loadu_ps(in + i), vmin);
+            __m128 y0 = _mm_rsqrt_ps(v);
+            __m128 t = _mm_mul_ps(_mm_mul_ps(half, v), _mm_mul_ps(y0, y0));
+            _mm_storeu_ps(out + i, _mm_mul_ps(y0, _mm_sub_ps(threeHalves, t)));
+        }
+        break;
+    default:
+        for (; i + 4 <= n; i += 4) {
+            __m128 v = _mm_max_ps(_mm_loadu_ps(in + i), vmin);
+            _mm_storeu_ps(out + i, _mm_div_ps(one, _mm_sqrt_ps(v)));
+        }
+        break;
+    }
+    InvSqrtScalar(in + i, out + i, n - i, mode, minValue);
+}
+
+// ============================================================================
+// AVX2 (8개씩)
+// ============================================================================
+SIMD_TARGET_AVX2
+void InvSqrtAVX2(const float* in, float* out, size_t n, InvSqrtMode mode, float minValue) {
+    const __m256 vmin = _mm256_set1_ps(minValue);
+    const __m256 one = _mm256_set1_ps(1.0f);
+    const __m256 half = _mm256_set1_ps(0.5f);
+    const __m256 threeHalves = _mm256_set1_ps(1.5f);
+    size_t i = 0;
+    switch (mode) {
+    case InvSqrtMode::Approx:
+        for (; i + 8 <= n; i += 8) {
+            __m256 v = _mm256_max_ps(_mm256_loadu_ps(in + i), vmin);
+            _mm256_storeu_ps(out + i, _mm256_rsqrt_ps(v));
+        }
+        break;
+    case InvSqrtMode::Fast:
+        for (; i + 8 <= n; i += 8) {
+            __m256 v = _mm256_max_ps(_mm256_loadu_ps(in + i), vmin);
+            __m256 y0 = _mm256_rsqrt_ps(v);
+            __m256 t = _mm256_mul_ps(_mm256_mul_ps(half, v), _mm256_mul_ps(y0, y0));
+            _mm256_storeu_ps(out + i, _mm256_mul_ps(y0, _mm256_sub_ps(threeHalves, t)));
+        }
+        break;
+    default:
+        for (; i + 8 <= n; i += 8) {
+            __m256 v = _mm256_max_ps(_mm256_loadu_ps(in + i), vmin);
+            _mm256_storeu_ps(out + i, _mm256_div_ps(one, _mm256_sqrt_ps(v)));
+        }
+        break;
+    }
+    InvSqrtScalar(in + i, out + i, n - i, mode, minValue);
+}
+
+} // namespace
+
+const char* GetInvSqrtModeName(InvSqrtMode mode) {
+    switch (mode) {
+    case InvSqrtMode::Fast:   return "Fast (rsqrt+NR)";
+    case InvSqrtMode::Approx: return "Approx (rsqrt)";
+    default:                  return "Exact (1/sqrt)";
+    }
+}
+
+float InvSqrt(float x, InvSqrtMode mode, float minValue) {
+    return InvSqrtOne(x, mode, minValue);
+}
+
+void InvSqrtBatch(const float* in, float* out, size_t count, InvSqrtMode mode, float minValue) {
+    switch (GetSimdLevel()) {
+    case SimdLevel::AVX2:  InvSqrtAVX2(in, out, count, mode, minValue); break;
+    case SimdLevel::SSE41: InvSqrtSSE(in, out, count, mode, minValue); break;
+    default:               InvSqrtScalar(in, out, count, mode, minValue); break;
+    }
+}
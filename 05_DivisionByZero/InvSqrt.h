@@ -0,0 +1,43 @@
+/*============================================================================
+ *  InvSqrt - 정밀도 모드를 고를 수 있는 역제곱근 (1 / sqrt(x))
+ *  ---------------------------------------------------------------------------
+ *  BUG D처럼 1.0f / sqrtf(distSq)는 distSq == 0이면 inf가 됩니다.
+ *  InvSqrt는 모든 모드에서 입력을 minValue 이상으로 클램프하므로
+ *  결과는 항상 1 / sqrt(minValue) 이하의 유한한 값입니다.
+ *  (음수/NaN 입력도 minValue로 취급 - 거리 제곱에는 나올 수 없는 값이므로)
+ *  inf 입력은 Exact/Approx에서 0, Fast에서는 NaN(inf * 0)이 됩니다.
+ *
+ *  [모드별 최대 상대 오차]  (정확한 1/sqrt(x) 대비)
+ *  - Exact    : sqrt + 나눗셈.          ≤ 1 ulp 수준 (약 1.2e-7)
+ *  - Fast     : rsqrt + Newton-Raphson 1회. 약 5e-7 이하 (≈ 2^-21)
+ *  - Approx   : rsqrt 하드웨어 근사값만. ≤ 1.5 × 2^-12 (약 3.7e-4)
+ *
+ *  Approx 모드의 결과는 CPU 제조사(Intel/AMD)마다 다를 수 있으므로
+ *  리플레이/락스텝처럼 결정적 결과가 필요한 곳에서는 Exact를 쓰세요.
+ *  조향(steering)/AI의 방향 계산처럼 약간의 오차가 괜찮은 곳은 Fast,
+ *  시각 효과처럼 대략적인 값이면 충분한 곳은 Approx가 적당합니다.
+ *============================================================================*/
+#pragma once
+
+#include <cstddef>
+
+enum class InvSqrtMode {
+    Exact,    // 1.0f / sqrtf(x)
+    Fast,     // rsqrt + Newton-Raphson 1회
+    Approx,   // rsqrt 근사값
+};
+
+// 기본 클램프 값: 1 / sqrt(1e-12) = 1e6
+const float kInvSqrtMinValue = 1e-12f;
+
+const char* GetInvSqrtModeName(InvSqrtMode mode);
+
+// 단일 값 (SSE 스칼라 명령어 사용 - x64에서는 항상 사용 가능)
+float InvSqrt(float x, InvSqrtMode mode = InvSqrtMode::Exact,
+              float minValue = kInvSqrtMinValue);
+
+// out[i] = InvSqrt(in[i]) - SimdDispatch로 AVX2/SSE4.1/Scalar 선택
+// in과 out은 같은 배열이어도 됩니다. 단일 값 버전과 결과가 비트 단위로 같습니다.
+void InvSqrtBatch(const float* in, float* out, size_t count,
+                  InvSqrtMode mode = InvSqrtMode::Exact,
+                  float minValue = kInvSqrtMinValue);
@@ -0,0 +1,187 @@
+/*============================================================================
+ *  SpriteAnimation.cpp - Scalar / SSE4.1 / AVX2 갱신 커널
+ *  ---------------------------------------------------------------------------
+ *  세 커널은 같은 순서로 계산하고 FMA를 쓰지 않으므로 결과가 비트 단위로 같습니다.
+ *  floor는 SSE4.1의 round 명령어(_mm_floor_ps)를 사용합니다.
+ *============================================================================*/
+#include "SpriteAnimation.h"
+#include "SimdDispatch.h"
+
+#include <cassert>
+#include <cmath>
+
+namespace {
+
+struct SpriteArrays {
+    int32_t*       frame;
+    float*         accumulator;
+    const float*   frameTime;
+    const float*   invFrameTime;
+    const float*   frameCount;
+    const float*   invFrameCount;
+    const int32_t* loopMask;
+};
+
+// ============================================================================
+// Scalar
+// ============================================================================
+void UpdateScalar(const SpriteArrays& s, size_t begin, size_t n, float dt) {
+    for (size_t i = begin; i < n; i++) {
+        float acc = s.accumulator[i] + dt;
+        float step = floorf(acc * s.invFrameTime[i]);
+        acc = acc - step * s.frameTime[i];
+        s.accumulator[i] = acc > 0.0f ? acc : 0.0f;   // 반올림으로 생긴 -0.0000x 제거
+
+        float frame = (float)s.frame[i] + step;
+        float count = s.frameCount[i];
+
+        float looped = frame - floorf(frame * s.invFrameCount[i]) * count;
+        looped = looped >= count ? looped - count : looped;
+        looped = looped < 0.0f ? looped + count : looped;
+
+        float last = count - 1.0f;
+        float clamped = frame < last ? frame : last;
+
+        s.frame[i] = (int32_t)(s.loopMask[i] ? looped : clamped);
+    }
+}
+
+// ============================================================================
+// SSE4.1 (4개씩)
+// ============================================================================
+SIMD_TARGET_SSE41
+void UpdateSSE(const SpriteArrays& s, size_t n, float dt) {
+    const __m128 vdt = _mm_set1_ps(dt);
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 one = _mm_set1_ps(1.0f);
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128 acc = _mm_add_ps(_mm_loadu_ps(s.accumulator + i), vdt);
+        __m128 step = _mm_floor_ps(_mm_mul_ps(acc, _mm_loadu_ps(s.invFrameTime + i)));
+        acc = _mm_sub_ps(acc, _mm_mul_ps(step, _mm_loadu_ps(s.frameTime + i)));
+        _mm_storeu_ps(s.accumulator + i, _mm_max_ps(acc, zero));
+
+        __m128i* framePtr = reinterpret_cast<__m128i*>(s.frame + i);
+        __m128 frame = _mm_add_ps(_mm_cvtepi32_ps(_mm_loadu_si128(framePtr)), step);
+        __m128 count = _mm_loadu_ps(s.frameCount + i);
+
+        __m128 wraps = _mm_floor_ps(_mm_mul_ps(frame, _mm_loadu_ps(s.invFrameCount + i)));
+        __m128 looped = _mm_sub_ps(frame, _mm_mul_ps(wraps, count));
+        looped = _mm_blendv_ps(looped, _mm_sub_ps(looped, count), _mm_cmpge_ps(looped, count));
+        looped = _mm_blendv_ps(looped, _mm_add_ps(looped, count), _mm_cmplt_ps(looped, zero));
+
+        __m128 clamped = _mm_min_ps(frame, _mm_sub_ps(count, one));
+
+        __m128 loopMask = _mm_castsi128_ps(
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(s.loopMask + i)));
+        __m128 result = _mm_blendv_ps(clamped, looped, loopMask);
+        _mm_storeu_si128(framePtr, _mm_cvttps_epi32(result));
+    }
+    UpdateScalar(s, i, n, dt);
+}
+
+// ============================================================================
+// AVX2 (8개씩)
+// ============================================================================
+SIMD_TARGET_AVX2
+void UpdateAVX2(const SpriteArrays& s, size_t n, float dt) {
+    const __m256 vdt = _mm256_set1_ps(dt);
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 one = _mm256_set1_ps(1.0f);
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256 acc = _mm256_add_ps(_mm256_loadu_ps(s.accumulator + i), vdt);
+        __m256 step = _mm256_floor_ps(_mm256_mul_ps(acc, _mm256_loadu_ps(s.invFrameTime + i)));
+        acc = _mm256_sub_ps(acc, _mm256_mul_ps(step, _mm256_loadu_ps(s.frameTime + i)));
+        _mm256_storeu_ps(s.accumulator + i, _mm256_max_ps(acc, zero));
+
+        __m256i* framePtr = reinterpret_cast<__m256i*>(s.frame + i);
+        __m256 frame = _mm256_add_ps(_mm256_cvtepi32_ps(_mm256_loadu_si256(framePtr)), step);
+        __m256 count = _mm256_loadu_ps(s.frameCount + i);
+
+        __m256 wraps = _mm256_floor_ps(_mm256_mul_ps(frame, _mm256_loadu_ps(s.invFrameCount + i)));
+        __m256 looped = _mm256_sub_ps(frame, _mm256_mul_ps(wraps, count));
+        looped = _mm256_blendv_ps(looped, _mm256_sub_ps(looped, count),
+                                  _mm256_cmp_ps(looped, count, _CMP_GE_OQ));
+        looped = _mm256_blendv_ps(looped, _mm256_add_ps(looped, count),
+                                  _mm256_cmp_ps(looped, zero, _CMP_LT_OQ));
+
+        __m256 clamped = _mm256_min_ps(frame, _mm256_sub_ps(count, one));
+
+        __m256 loopMask = _mm256_castsi256_ps(
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s.loopMask + i)));
+        __m256 result = _mm256_blendv_ps(clamped, looped, loopMask);
+        _mm256_storeu_si256(framePtr, _mm256_cvttps_epi32(result));
+    }
+    UpdateScalar(s, i, n, dt);
+}
+
+} // namespace
+
+bool SpriteAnimationSystem::IsValidClip(const SpriteClip& clip) {
+    // !(fps > 0)은 NaN도 걸러냄
+    if (!(clip.fps > 0.0f) || clip.fps > kMaxFps) return false;
+    return clip.frameCount >= 1 && clip.frameCount <= kMaxFrameCount;
+}
+
+size_t SpriteAnimationSystem::AddSprite(const SpriteClip& clip) {
+    if (!IsValidClip(clip)) return kInvalidSprite;
+
+    m_Frame.push_back(0);
+    m_Accumulator.push_back(0.0f);
+    m_FrameTime.push_back(1.0f / clip.fps);
+    m_InvFrameTime.push_back(clip.fps);
+    m_FrameCount.push_back((float)clip.frameCount);
+    m_InvFrameCount.push_back(1.0f / (float)clip.frameCount);
+    m_LoopMask.push_back(clip.loop ? -1 : 0);
+    return m_Frame.size() - 1;
+}
+
+bool SpriteAnimationSystem::SetFps(size_t sprite, float fps) {
+    assert(sprite < Size());
+    SpriteClip clip;
+    clip.frameCount = (int)m_FrameCount[sprite];
+    clip.fps = fps;
+    if (!IsValidClip(clip)) return false;
+
+    m_FrameTime[sprite] = 1.0f / fps;
+    m_InvFrameTime[sprite] = fps;
+    return true;
+}
+
+void SpriteAnimationSystem::Reserve(size_t count) {
+    m_Frame.reserve(count);
+    m_Accumulator.reserve(count);
+    m_FrameTime.reserve(count);
+    m_InvFrameTime.reserve(count);
+    m_FrameCount.reserve(count);
+    m_InvFrameCount.reserve(count);
+    m_LoopMask.reserve(count);
+}
+
+void SpriteAnimationSystem::Clear() {
+    m_Frame.clear();
+    m_Accumulator.clear();
+    m_FrameTime.clear();
+    m_InvFrameTime.clear();
+    m_FrameCount.clear();
+    m_InvFrameCount.clear();
+    m_LoopMask.clear();
+}
+
+bool SpriteAnimationSystem::IsFinished(size_t sprite) const {
+    return m_LoopMask[sprite] == 0 && (float)m_Frame[sprite] >= m_FrameCount[sprite] - 1.0f;
+}
+
+void SpriteAnimationSystem::Update(float dt) {
+    assert(dt >= 0.0f);
+    SpriteArrays s = { m_Frame.data(), m_Accumulator.data(), m_FrameTime.data(),
+                       m_InvFrameTime.data(), m_FrameCount.data(), m_InvFrameCount.data(),
+                       m_LoopMask.data() };
+    size_t n = Size();
+    switch (GetSimdLevel()) {
+    case SimdLevel::AVX2:  UpdateAVX2(s, n, dt); break;
+    case SimdLevel::SSE41: UpdateSSE(s, n, dt); break;
+    default:               UpdateScalar(s, 0, n, dt); break;
+    }
+}
@@ -0,0 +1,73 @@
+/*============================================================================
+ *  SpriteAnimation - SoA 스프라이트 애니메이션 일괄 갱신
+ *  ---------------------------------------------------------------------------
+ *  SpriteSheet::GetDuration()은 조회할 때마다 fps로 나누고, fps == 0이면 inf가 됩니다(BUG A).
+ *  여기서는 fps를 등록/변경 시점에 한 번만 검사하고 역수(프레임 시간)를 미리 저장하므로
+ *  매 프레임 갱신 루프에는 나눗셈도, 0 검사도 없습니다.
+ *
+ *  스프라이트마다 아래 값을 각각의 배열(SoA)로 저장합니다:
+ *      frame        현재 프레임 번호
+ *      accumulator  현재 프레임에서 흐른 시간 (초)
+ *      frameTime    1 / fps        (등록 시 계산)
+ *      invFrameTime fps            (accumulator → 넘어갈 프레임 수)
+ *      frameCount / invFrameCount  (루프 처리)
+ *
+ *  Update(dt)는 분기 없이 계산합니다:
+ *      acc  += dt
+ *      step  = floor(acc * invFrameTime)       // dt가 커도(히치) 한 번에 여러 프레임 전진
+ *      acc  -= step * frameTime
+ *      frame = 루프면 (frame + step) mod frameCount, 아니면 마지막 프레임에서 정지
+ *
+ *  커널은 SimdDispatch로 선택되며 (AVX2 → SSE4.1 → Scalar) 결과가 비트 단위로 같습니다.
+ *============================================================================*/
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Vector3Batch.h"
+
+struct SpriteClip {
+    int   frameCount = 1;
+    float fps        = 12.0f;
+    bool  loop       = true;
+};
+
+class SpriteAnimationSystem {
+public:
+    static constexpr size_t kInvalidSprite = SIZE_MAX;
+
+    // fps: 유한하고 0보다 크며 kMaxFps 이하, frameCount: 1 이상 kMaxFrameCount 이하
+    static constexpr int   kMaxFrameCount = 1 << 20;
+    static constexpr float kMaxFps = 1000.0f;
+    static bool IsValidClip(const SpriteClip& clip);
+
+    // 잘못된 클립이면 등록하지 않고 kInvalidSprite 반환
+    size_t AddSprite(const SpriteClip& clip);
+
+    // 재생 속도 변경. 잘못된 fps면 기존 값을 유지하고 false
+    bool SetFps(size_t sprite, float fps);
+
+    void Reserve(size_t count);
+    void Clear();
+
+    // 모든 스프라이트를 dt초만큼 진행 (dt는 0 이상)
+    void Update(float dt);
+
+    size_t Size() const { return m_Frame.size(); }
+    int    GetFrame(size_t sprite) const { return m_Frame[sprite]; }
+    float  GetAccumulator(size_t sprite) const { return m_Accumulator[sprite]; }
+    bool   IsFinished(size_t sprite) const;
+
+private:
+    using AlignedIntArray = std::vector<int32_t, AlignedAllocator<int32_t>>;
+
+    AlignedIntArray   m_Frame;
+    AlignedFloatArray m_Accumulator;
+    AlignedFloatArray m_FrameTime;
+    AlignedFloatArray m_InvFrameTime;
+    AlignedFloatArray m_FrameCount;
+    AlignedFloatArray m_InvFrameCount;
+    AlignedIntArray   m_LoopMask;       // 루프면 -1 (모든 비트 1), 아니면 0
+};
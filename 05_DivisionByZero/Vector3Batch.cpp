@@ -0,0 +1,338 @@
+/*============================================================================
+ *  Vector3Batch.cpp - Scalar / SSE4.1 / AVX2 커널
+ *  ---------------------------------------------------------------------------
+ *  각 연산은 같은 순서로 계산합니다: lenSq = (x*x + y*y) + z*z
+ *  SIMD 커널은 레지스터 폭(4/8)으로 나누어 떨어지지 않는 꼬리 부분을
+ *  Scalar 커널로 처리합니다.
+ *============================================================================*/
+#include "Vector3Batch.h"
+#include "SimdDispatch.h"
+
+#include <cassert>
+#include <cmath>
+
+namespace {
+
+// ============================================================================
+// Scalar
+// ============================================================================
+void LengthScalar(const float* x, const float* y, const float* z, float* out, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        float lenSq = x[i] * x[i] + y[i] * y[i] + z[i] * z[i];
+        out[i] = sqrtf(lenSq);
+    }
+}
+
+void DotScalar(const float* ax, const float* ay, const float* az,
+               const float* bx, const float* by, const float* bz, float* out, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        out[i] = ax[i] * bx[i] + ay[i] * by[i] + az[i] * bz[i];
+    }
+}
+
+void NormalizeScalar(float* x, float* y, float* z, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        float len = sqrtf(x[i] * x[i] + y[i] * y[i] + z[i] * z[i]);
+        x[i] /= len; y[i] /= len; z[i] /= len;
+    }
+}
+
+// 스칼라 기준 구현 (SIMD 커널은 이 결과와 비트 단위로 같아야 함)
+void NormalizeSafeScalar(float* x, float* y, float* z, size_t n,
+                         float fx, float fy, float fz, float epsilonSq) {
+    for (size_t i = 0; i < n; i++) {
+        float lenSq = x[i] * x[i] + y[i] * y[i] + z[i] * z[i];
+        if (lenSq > epsilonSq) {
+            float len = sqrtf(lenSq);
+            x[i] /= len; y[i] /= len; z[i] /= len;
+        } else {
+            x[i] = fx; y[i] = fy; z[i] = fz;
+        }
+    }
+}
+
+void AddScalar(const float* a, const float* b, float* out, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        out[i] = a[i] + b[i];
+    }
+}
+
+void MulAddScalar(const float* a, const float* b, float s, float* out, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        out[i] = a[i] + b[i] * s;
+    }
+}
+
+// ============================================================================
+// SSE4.1 (4개씩)
+// ============================================================================
+SIMD_TARGET_SSE41
+void LengthSSE(const float* x, const float* y, const float* z, float* out, size_t n) {
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128 vx = _mm_loadu_ps(x + i);
+        __m128 vy = _mm_loadu_ps(y + i);
+        __m128 vz = _mm_loadu_ps(z + i);
+        __m128 lenSq = _mm_add_ps(_mm_add_ps(_mm_mul_ps(vx, vx), _mm_mul_ps(vy, vy)),
+                                  _mm_mul_ps(vz, vz));
+        _mm_storeu_ps(out + i, _mm_sqrt_ps(lenSq));
+    }
+    LengthScalar(x + i, y + i, z + i, out + i, n - i);
+}
+
+SIMD_TARGET_SSE41
+void DotSSE(const float* ax, const float* ay, const float* az,
+            const float* bx, const float* by, const float* bz, float* out, size_t n) {
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128 d = _mm_add_ps(
+            _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(ax + i), _mm_loadu_ps(bx + i)),
+                       _mm_mul_ps(_mm_loadu_ps(ay + i), _mm_loadu_ps(by + i))),
+            _mm_mul_ps(_mm_loadu_ps(az + i), _mm_loadu_ps(bz + i)));
+        _mm_storeu_ps(out + i, d);
+    }
+    DotScalar(ax + i, ay + i, az + i, bx + i, by + i, bz + i, out + i, n - i);
+}
+
+SIMD_TARGET_SSE41
+void NormalizeSSE(float* x, float* y, float* z, size_t n) {
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128 vx = _mm_loadu_ps(x + i);
+        __m128 vy = _mm_loadu_ps(y + i);
+        __m128 vz = _mm_loadu_ps(z + i);
+        __m128 len = _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(vx, vx), _mm_mul_ps(vy, vy)),
+                                            _mm_mul_ps(vz, vz)));
+        _mm_storeu_ps(x + i, _mm_div_ps(vx, len));
+        _mm_storeu_ps(y + i, _mm_div_ps(vy, len));
+        _mm_storeu_ps(z + i, _mm_div_ps(vz, len));
+    }
+    NormalizeScalar(x + i, y + i, z + i, n - i);
+}
+
+SIMD_TARGET_SSE41
+void NormalizeSafeSSE(float* x, float* y, float* z, size_t n,
+                      float fx, float fy, float fz, float epsilonSq) {
+    __m128 vfx = _mm_set1_ps(fx), vfy = _mm_set1_ps(fy), vfz = _mm_set1_ps(fz);
+    __m128 veps = _mm_set1_ps(epsilonSq);
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128 vx = _mm_loadu_ps(x + i);
+        __m128 vy = _mm_loadu_ps(y + i);
+        __m128 vz = _mm_loadu_ps(z + i);
+        __m128 lenSq = _mm_add_ps(_mm_add_ps(_mm_mul_ps(vx, vx), _mm_mul_ps(vy, vy)),
+                                  _mm_mul_ps(vz, vz));
+        __m128 valid = _mm_cmpgt_ps(lenSq, veps);  // NaN이면 false
+        __m128 len = _mm_sqrt_ps(lenSq);
+        _mm_storeu_ps(x + i, _mm_blendv_ps(vfx, _mm_div_ps(vx, len), valid));
+        _mm_storeu_ps(y + i, _mm_blendv_ps(vfy, _mm_div_ps(vy, len), valid));
+        _mm_storeu_ps(z + i, _mm_blendv_ps(vfz, _mm_div_ps(vz, len), valid));
+    }
+    NormalizeSafeScalar(x + i, y + i, z + i, n - i, fx, fy, fz, epsilonSq);
+}
+
+SIMD_TARGET_SSE41
+void AddSSE(const float* a, const float* b, float* out, size_t n) {
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        _mm_storeu_ps(out + i, _mm_add_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+    }
+    AddScalar(a + i, b + i, out + i, n - i);
+}
+
+SIMD_TARGET_SSE41
+void MulAddSSE(const float* a, const float* b, float s, float* out, size_t n) {
+    __m128 vs = _mm_set1_ps(s);
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        __m128 r = _mm_add_ps(_mm_loadu_ps(a + i), _mm_mul_ps(_mm_loadu_ps(b + i), vs));
+        _mm_storeu_ps(out + i, r);
+    }
+    MulAddScalar(a + i, b + i, s, out + i, n - i);
+}
+
+// ============================================================================
+// AVX2 (8개씩)
+// ============================================================================
+SIMD_TARGET_AVX2
+void LengthAVX2(const float* x, const float* y, const float* z, float* out, size_t n) {
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256 vx = _mm256_loadu_ps(x + i);
+        __m256 vy = _mm256_loadu_ps(y + i);
+        __m256 vz = _mm256_loadu_ps(z + i);
+        __m256 lenSq = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(vx, vx), _mm256_mul_ps(vy, vy)),
+                                     _mm256_mul_ps(vz, vz));
+        _mm256_storeu_ps(out + i, _mm256_sqrt_ps(lenSq));
+    }
+    LengthScalar(x + i, y + i, z + i, out + i, n - i);
+}
+
+SIMD_TARGET_AVX2
+void DotAVX2(const float* ax, const float* ay, const float* az,
+             const float* bx, const float* by, const float* bz, float* out, size_t n) {
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256 d = _mm256_add_ps(
+            _mm256_add_ps(_mm256_mul_ps(_mm256_loadu_ps(ax + i), _mm256_loadu_ps(bx + i)),
+                          _mm256_mul_ps(_mm256_loadu_ps(ay + i), _mm256_loadu_ps(by + i))),
+            _mm256_mul_ps(_mm256_loadu_ps(az + i), _mm256_loadu_ps(bz + i)));
+        _mm256_storeu_ps(out + i, d);
+    }
+    DotScalar(ax + i, ay + i, az + i, bx + i, by + i, bz + i, out + i, n - i);
+}
+
+SIMD_TARGET_AVX2
+void NormalizeAVX2(float* x, float* y, float* z, size_t n) {
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256 vx = _mm256_loadu_ps(x + i);
+        __m256 vy = _mm256_loadu_ps(y + i);
+        __m256 vz = _mm256_loadu_ps(z + i);
+        __m256 len = _mm256_sqrt_ps(_mm256_add_ps(
+            _mm256_add_ps(_mm256_mul_ps(vx, vx), _mm256_mul_ps(vy, vy)), _mm256_mul_ps(vz, vz)));
+        _mm256_storeu_ps(x + i, _mm256_div_ps(vx, len));
+        _mm256_storeu_ps(y + i, _mm256_div_ps(vy, len));
+        _mm256_storeu_ps(z + i, _mm256_div_ps(vz, len));
+    }
+    NormalizeScalar(x + i, y + i, z + i, n - i);
+}
+
+SIMD_TARGET_AVX2
+void NormalizeSafeAVX2(float* x, float* y, float* z, size_t n,
+                       float fx, float fy, float fz, float epsilonSq) {
+    __m256 vfx = _mm256_set1_ps(fx), vfy = _mm256_set1_ps(fy), vfz = _mm256_set1_ps(fz);
+    __m256 veps = _mm256_set1_ps(epsilonSq);
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256 vx = _mm256_loadu_ps(x + i);
+        __m256 vy = _mm256_loadu_ps(y + i);
+        __m256 vz = _mm256_loadu_ps(z + i);
+        __m256 lenSq = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(vx, vx), _mm256_mul_ps(vy, vy)),
+                                     _mm256_mul_ps(vz, vz));
+        __m256 valid = _mm256_cmp_ps(lenSq, veps, _CMP_GT_OQ);  // NaN이면 false
+        __m256 len = _mm256_sqrt_ps(lenSq);
+        _mm256_storeu_ps(x + i, _mm256_blendv_ps(vfx, _mm256_div_ps(vx, len), valid));
+        _mm256_storeu_ps(y + i, _mm256_blendv_ps(vfy, _mm256_div_ps(vy, len), valid));
+        _mm256_storeu_ps(z + i, _mm256_blendv_ps(vfz, _mm256_div_ps(vz, len), valid));
+    }
+    NormalizeSafeScalar(x + i, y + i, z + i, n - i, fx, fy, fz, epsilonSq);
+}
+
+SIMD_TARGET_AVX2
+void AddAVX2(const float* a, const float* b, float* out, size_t n) {
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        _mm256_storeu_ps(out + i, _mm256_add_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i)));
+    }
+    AddScalar(a + i, b + i, out + i, n - i);
+}
+
+SIMD_TARGET_AVX2
+void MulAddAVX2(const float* a, const float* b, float s, float* out, size_t n) {
+    __m256 vs = _mm256_set1_ps(s);
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        // FMA를 쓰면 반올림이 한 번 줄어 Scalar와 결과가 달라지므로 mul + add로 분리
+        __m256 r = _mm256_add_ps(_mm256_loadu_ps(a + i), _mm256_mul_ps(_mm256_loadu_ps(b + i), vs));
+        _mm256_storeu_ps(out + i, r);
+    }
+    MulAddScalar(a + i, b + i, s, out + i, n - i);
+}
+
+} // namespace
+
+// ============================================================================
+// 디스패치
+// ============================================================================
+namespace Vector3Ops {
+
+void Length(const Vector3Batch& v, float* out) {
+    size_t n = v.Size();
+    switch (GetSimdLevel()) {
+    case SimdLevel::AVX2:  LengthAVX2(v.X(), v.Y(), v.Z(), out, n); break;
+    case SimdLevel::SSE41: LengthSSE(v.X(), v.Y(), v.Z(), out, n); break;
+    default:               LengthScalar(v.X(), v.Y(), v.Z(), out, n); break;
+    }
+}
+
+void Dot(const Vector3Batch& a, const Vector3Batch& b, float* out) {
+    assert(a.Size() == b.Size());
+    size_t n = a.Size();
+    switch (GetSimdLevel()) {
+    case SimdLevel::AVX2:  DotAVX2(a.X(), a.Y(), a.Z(), b.X(), b.Y(), b.Z(), out, n); break;
+    case SimdLevel::SSE41: DotSSE(a.X(), a.Y(), a.Z(), b.X(), b.Y(), b.Z(), out, n); break;
+    default:               DotScalar(a.X(), a.Y(), a.Z(), b.X(), b.Y(), b.Z(), out, n); break;
+    }
+}
+
+void Normalize(Vector3Batch& v) {
+    size_t n = v.Size();
+    switch (GetSimdLevel()) {
+    case SimdLevel::AVX2:  NormalizeAVX2(v.X(), v.Y(), v.Z(), n); break;
+    case SimdLevel::SSE41: NormalizeSSE(v.X(), v.Y(), v.Z(), n); break;
+    default:               NormalizeScalar(v.X(), v.Y(), v.Z(), n); break;
+    }
+}
+
+void NormalizeSafe(Vector3Batch& v, float fallbackX, float fallbackY, float fallbackZ,
+                   float epsilonSq) {
+    size_t n = v.Size();
+    switch (GetSimdLevel()) {
+    case SimdLevel::AVX2:
+        NormalizeSafeAVX2(v.X(), v.Y(), v.Z(), n, fallbackX, fallbackY, fallbackZ, epsilonSq);
+        break;
+    case SimdLevel::SSE41:
+        NormalizeSafeSSE(v.X(), v.Y(), v.Z(), n, fallbackX, fallbackY, fallbackZ, epsilonSq);
+        break;
+    default:
+        NormalizeSafeScalar(v.X(), v.Y(), v.Z(), n, fallbackX, fallbackY, fallbackZ, epsilonSq);
+        break;
+    }
+}
+
+void Add(const Vector3Batch& a, const Vector3Batch& b, Vector3Batch& out) {
+    assert(a.Size() == b.Size() && a.Size() == out.Size());
+    size_t n = a.Size();
+    switch (GetSimdLevel()) {
+    case SimdLevel::AVX2:
+        AddAVX2(a.X(), b.X(), out.X(), n);
+        AddAVX2(a.Y(), b.Y(), out.Y(), n);
+        AddAVX2(a.Z(), b.Z(), out.Z(), n);
+        break;
+    case SimdLevel::SSE41:
+        AddSSE(a.X(), b.X(), out.X(), n);
+        AddSSE(a.Y(), b.Y(), out.Y(), n);
+        AddSSE(a.Z(), b.Z(), out.Z(), n);
+        break;
+    default:
+        AddScalar(a.X(), b.X(), out.X(), n);
+        AddScalar(a.Y(), b.Y(), out.Y(), n);
+        AddScalar(a.Z(), b.Z(), out.Z(), n);
+        break;
+    }
+}
+
+void MulAdd(const Vector3Batch& a, const Vector3Batch& b, float s, Vector3Batch& out) {
+    assert(a.Size() == b.Size() && a.Size() == out.Size());
+    size_t n = a.Size();
+    switch (GetSimdLevel()) {
+    case SimdLevel::AVX2:
+        MulAddAVX2(a.X(), b.X(), s, out.X(), n);
+        MulAddAVX2(a.Y(), b.Y(), s, out.Y(), n);
+        MulAddAVX2(a.Z(), b.Z(), s, out.Z(), n);
+        break;
+    case SimdLevel::SSE41:
+        MulAddSSE(a.X(), b.X(), s, out.X(), n);
+        MulAddSSE(a.Y(), b.Y(), s, out.Y(), n);
+        MulAddSSE(a.Z(), b.Z(), s, out.Z(), n);
+        break;
+    default:
+        MulAddScalar(a.X(), b.X(), s, out.X(), n);
+        MulAddScalar(a.Y(), b.Y(), s, out.Y(), n);
+        MulAddScalar(a.Z(), b.Z(), s, out.Z(), n);
+        break;
+    }
+}
+
+} // namespace Vector3Ops
@@ -0,0 +1,118 @@
+/*============================================================================
+ *  Vector3Batch - SoA(Structure of Arrays) 벡터 묶음과 SIMD 일괄 연산
+ *  ---------------------------------------------------------------------------
+ *  Vector3 배열(AoS)은 x,y,z가 번갈아 저장되어 있어서 SIMD 레지스터에
+ *  같은 성분 8개를 한 번에 올릴 수 없습니다.
+ *
+ *      AoS: x0 y0 z0 x1 y1 z1 x2 y2 z2 ...
+ *      SoA: x0 x1 x2 ... / y0 y1 y2 ... / z0 z1 z2 ...
+ *
+ *  SoA로 저장하면 AVX2 한 명령어로 벡터 8개의 같은 성분을 동시에 처리합니다.
+ *  커널은 SimdDispatch로 실행 시 선택되며 (AVX2 → SSE4.1 → Scalar),
+ *  FMA를 쓰지 않고 곱셈/덧셈을 분리해서 세 커널의 결과가 비트 단위로 같습니다.
+ *  (머신마다 결과가 달라지면 리플레이/락스텝 동기화가 깨지기 때문)
+ *
+ *  Normalize는 Vector3::Normalize와 동일하게 길이로 그대로 나눕니다.
+ *  영벡터는 NaN이 됩니다 - 안전 버전은 NormalizeSafe를 사용하세요.
+ *
+ *  NormalizeSafe는 분기 없이 동작합니다: 모든 레인에서 나눗셈을 한 뒤
+ *  lenSq > epsilonSq 마스크로 결과와 대체 벡터 중 하나를 고릅니다(blend).
+ *  영벡터 레인에서 생긴 NaN은 blend로 버려지므로 밖으로 새지 않습니다.
+ *============================================================================*/
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include <vector>
+
+// SIMD 로드/스토어가 캐시라인을 가로지르지 않도록 32바이트 정렬
+template <typename T, size_t Alignment = 32>
+struct AlignedAllocator {
+    using value_type = T;
+
+    AlignedAllocator() = default;
+    template <typename U>
+    AlignedAllocator(const AlignedAllocator<U, Alignment>&) {}
+
+    template <typename U>
+    struct rebind { using other = AlignedAllocator<U, Alignment>; };
+
+    T* allocate(size_t n) {
+        return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t(Alignment)));
+    }
+    void deallocate(T* p, size_t) {
+        ::operator delete(p, std::align_val_t(Alignment));
+    }
+
+    template <typename U>
+    bool operator==(const AlignedAllocator<U, Alignment>&) const { return true; }
+    template <typename U>
+    bool operator!=(const AlignedAllocator<U, Alignment>&) const { return false; }
+};
+
+using AlignedFloatArray = std::vector<float, AlignedAllocator<float>>;
+
+class Vector3Batch {
+public:
+    Vector3Batch() = default;
+    explicit Vector3Batch(size_t count) { Resize(count); }
+
+    // 늘어난 원소는 (0, 0, 0)
+    void Resize(size_t count) {
+        m_X.resize(count, 0.0f);
+        m_Y.resize(count, 0.0f);
+        m_Z.resize(count, 0.0f);
+    }
+
+    size_t Size() const { return m_X.size(); }
+
+    float*       X()       { return m_X.data(); }
+    float*       Y()       { return m_Y.data(); }
+    float*       Z()       { return m_Z.data(); }
+    const float* X() const { return m_X.data(); }
+    const float* Y() const { return m_Y.data(); }
+    const float* Z() const { return m_Z.data(); }
+
+    void Set(size_t i, float x, float y, float z) {
+        m_X[i] = x; m_Y[i] = y; m_Z[i] = z;
+    }
+
+    void Get(size_t i, float& x, float& y, float& z) const {
+        x = m_X[i]; y = m_Y[i]; z = m_Z[i];
+    }
+
+private:
+    AlignedFloatArray m_X;
+    AlignedFloatArray m_Y;
+    AlignedFloatArray m_Z;
+};
+
+// ============================================================================
+// 일괄 연산 - 모든 배치/출력 배열의 크기가 같아야 합니다.
+// 출력이 입력과 같은 배치여도 됩니다 (원소 단위 연산이므로 in-place 가능).
+// ============================================================================
+namespace Vector3Ops {
+
+// out[i] = |v[i]|
+void Length(const Vector3Batch& v, float* out);
+
+// out[i] = a[i] · b[i]
+void Dot(const Vector3Batch& a, const Vector3Batch& b, float* out);
+
+// v[i] = v[i] / |v[i]|   (영벡터 → NaN, Vector3::Normalize와 동일)
+void Normalize(Vector3Batch& v);
+
+// lenSq > epsilonSq 이면 v[i] / |v[i]|, 아니면 fallback
+// (NaN 입력도 비교가 false이므로 fallback이 됨)
+const float kDefaultNormalizeEpsilonSq = 1e-12f;
+
+void NormalizeSafe(Vector3Batch& v, float fallbackX, float fallbackY, float fallbackZ,
+                   float epsilonSq = kDefaultNormalizeEpsilonSq);
+
+// out[i] = a[i] + b[i]
+void Add(const Vector3Batch& a, const Vector3Batch& b, Vector3Batch& out);
+
+// out[i] = a[i] + b[i] * s   (예: position += velocity * dt)
+void MulAdd(const Vector3Batch& a, const Vector3Batch& b, float s, Vector3Batch& out);
+
+} // namespace Vector3Ops
@@ -11,6 +11,20 @@
 #include <iostream>
 #include <cmath>
 #include <limits>
+#include <vector>
+#include <chrono>
+#include <random>
+#include <cstring>
+#include <algorithm>
+#include <stdexcept>
+
+#include "SimdDispatch.h"
+#include "Vector3Batch.h"
+#include "InvSqrt.h"
+#include "FiniteValidator.h"
+#include "SpriteAnimation.h"
+#include "CachedCamera.h"
+#include "FastDivider.h"
 
 // ============================================================================
 // 간이 구조체
@@ -27,6 +41,17 @@ struct Vector3 {
         x /= len; y /= len; z /= len;  // len == 0이면 NaN!
     }
 
+    // GOOD: 길이 제곱이 epsilon 이하이면 fallback 방향을 사용 (NaN 방지)
+    void NormalizeSafe(const Vector3& fallback, float epsilonSq = 1e-12f) {
+        float lenSq = LengthSquared();
+        if (lenSq > epsilonSq) {
+            float len = sqrtf(lenSq);
+            x /= len; y /= len; z /= len;
+        } else {
+            *this = fallback;
+        }
+    }
+
     void Print(const char* label) const {
         std::cout << "    " << label << ": (" << x << ", " << y << ", " << z << ")\n";
     }
@@ -155,6 +180,761 @@ void BugD_NearZeroDistance() {
     std::cout << "  [결과] 적이 NaN 위치로 순간이동합니다!\n";
 }
 
+// ============================================================================
+// E: SoA Vector3Batch 일괄 연산 벤치마크
+// ============================================================================
+// fn을 rounds번 실행해서 가장 빠른 시간(ms)을 돌려줌. prepare는 측정에서 제외
+template <typename Prepare, typename Fn>
+double MeasureBestMs(int rounds, Prepare prepare, Fn fn) {
+    double best = 1e30;
+    for (int r = 0; r < rounds; r++) {
+        prepare();
+        auto start = std::chrono::steady_clock::now();
+        fn();
+        auto end = std::chrono::steady_clock::now();
+        double ms = std::chrono::duration<double, std::milli>(end - start).count();
+        if (ms < best) best = ms;
+    }
+    return best;
+}
+
+void BenchmarkVector3Batch() {
+    std::cout << "\n[E] SoA Vector3Batch 일괄 연산 벤치마크\n";
+    std::cout << "  Vector3(AoS)를 하나씩 Normalize() vs SoA 배치를 SIMD로 한 번에\n";
+    std::cout << "  (Debug 빌드에서는 수치가 크게 왜곡되므로 Release에서 측정하세요)\n\n";
+
+    const size_t COUNT = 4 * 1024 * 1024;
+    const int ROUNDS = 5;
+    SimdLevel supported = GetSupportedSimdLevel();
+    std::cout << "  CPU 지원 단계: " << GetSimdLevelName(supported)
+              << ", 벡터 " << COUNT << "개\n\n";
+
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<float> dist(-100.0f, 100.0f);
+    std::vector<Vector3> source(COUNT);
+    Vector3Batch sourceBatch(COUNT);
+    for (size_t i = 0; i < COUNT; i++) {
+        Vector3 v(dist(rng), dist(rng), dist(rng));
+        if (v.LengthSquared() == 0.0f) v.x = 1.0f;  // 이 벤치마크는 영벡터 제외
+        source[i] = v;
+        sourceBatch.Set(i, v.x, v.y, v.z);
+    }
+
+    // 1) 기준: AoS 루프
+    std::vector<Vector3> aos;
+    double aosMs = MeasureBestMs(ROUNDS, [&] { aos = source; }, [&] {
+        for (Vector3& v : aos) v.Normalize();
+    });
+    std::cout << "  Normalize  Vector3 루프 (AoS) : " << aosMs << " ms\n";
+
+    // 2) 단계별 SoA 커널 + 비트 단위 검증
+    Vector3Batch batch;
+    std::vector<float> lengths(COUNT);
+    const SimdLevel levels[] = { SimdLevel::Scalar, SimdLevel::SSE41, SimdLevel::AVX2 };
+    for (SimdLevel level : levels) {
+        if (level > supported) continue;
+        SetSimdLevel(level);
+
+        double normMs = MeasureBestMs(ROUNDS, [&] { batch = sourceBatch; }, [&] {
+            Vector3Ops::Normalize(batch);
+        });
+
+        size_t mismatches = 0;
+        for (size_t i = 0; i < COUNT; i++) {
+            float x, y, z;
+            batch.Get(i, x, y, z);
+            if (memcmp(&x, &aos[i].x, 4) != 0 || memcmp(&y, &aos[i].y, 4) != 0 ||
+                memcmp(&z, &aos[i].z, 4) != 0) {
+                mismatches++;
+            }
+        }
+
+        double lengthMs = MeasureBestMs(ROUNDS, [] {}, [&] {
+            Vector3Ops::Length(sourceBatch, lengths.data());
+        });
+        double mulAddMs = MeasureBestMs(ROUNDS, [&] { batch = sourceBatch; }, [&] {
+            Vector3Ops::MulAdd(batch, sourceBatch, 0.016f, batch);
+        });
+
+        std::cout << "  Normalize  SoA " << GetSimdLevelName(level) << " : " << normMs
+                  << " ms (" << aosMs / normMs << "x), AoS 결과와 불일치 " << mismatches << "개\n";
+        std::cout << "      Length " << lengthMs << " ms, MulAdd(pos += vel*dt) " << mulAddMs << " ms\n";
+    }
+    SetSimdLevel(supported);
+
+    std::cout << "\n  [결과] SoA + SIMD는 같은 결과를 내면서 여러 배 빠릅니다.\n";
+    std::cout << "  단, 영벡터가 섞이면 SIMD 커널도 똑같이 NaN을 만듭니다! (BUG C)\n";
+}
+
+// ============================================================================
+// F: 분기 없는 안전 정규화 (NormalizeSafe) 검증 / 벤치마크
+// ============================================================================
+bool SameBits(float a, float b) {
+    return memcmp(&a, &b, sizeof(float)) == 0;
+}
+
+void BenchmarkNormalizeSafe() {
+    std::cout << "\n[F] 분기 없는 안전 정규화 (NormalizeSafe)\n";
+    std::cout << "  영벡터/NaN 레인은 마스크로 fallback 벡터를 골라서 NaN이 새지 않습니다.\n";
+    std::cout << "  (Debug 빌드에서는 수치가 크게 왜곡되므로 Release에서 측정하세요)\n\n";
+
+    const size_t COUNT = 4 * 1024 * 1024;
+    const int ROUNDS = 5;
+    const Vector3 fallback(0.0f, 0.0f, 1.0f);
+    SimdLevel supported = GetSupportedSimdLevel();
+
+    // 약 10%는 영벡터, 일부는 매우 작은 벡터/NaN을 섞음
+    std::mt19937 rng(11);
+    std::uniform_real_distribution<float> dist(-100.0f, 100.0f);
+    std::vector<Vector3> source(COUNT);
+    Vector3Batch sourceBatch(COUNT);
+    size_t zeroCount = 0;
+    for (size_t i = 0; i < COUNT; i++) {
+        Vector3 v(dist(rng), dist(rng), dist(rng));
+        switch (rng() % 20) {
+        case 0: case 1: v = Vector3(0, 0, 0); zeroCount++; break;
+        case 2: v = Vector3(1e-7f, 0, 0); break;
+        case 3: if (rng() % 100 == 0) v.x = std::numeric_limits<float>::quiet_NaN(); break;
+        default: break;
+        }
+        source[i] = v;
+        sourceBatch.Set(i, v.x, v.y, v.z);
+    }
+
+    // 스칼라 기준값: Vector3::NormalizeSafe
+    std::vector<Vector3> reference = source;
+    for (Vector3& v : reference) v.NormalizeSafe(fallback);
+
+    std::cout << "  벡터 " << COUNT << "개 (영벡터 " << zeroCount << "개 포함)\n\n";
+
+    Vector3Batch batch;
+    const SimdLevel levels[] = { SimdLevel::Scalar, SimdLevel::SSE41, SimdLevel::AVX2 };
+    for (SimdLevel level : levels) {
+        if (level > supported) continue;
+        SetSimdLevel(level);
+
+        double unsafeMs = MeasureBestMs(ROUNDS, [&] { batch = sourceBatch; }, [&] {
+            Vector3Ops::Normalize(batch);
+        });
+        size_t unsafeNaN = 0;
+        for (size_t i = 0; i < COUNT; i++) {
+            if (std::isnan(batch.X()[i])) unsafeNaN++;
+        }
+
+        double safeMs = MeasureBestMs(ROUNDS, [&] { batch = sourceBatch; }, [&] {
+            Vector3Ops::NormalizeSafe(batch, fallback.x, fallback.y, fallback.z);
+        });
+        size_t mismatches = 0, safeNaN = 0;
+        for (size_t i = 0; i < COUNT; i++) {
+            float x, y, z;
+            batch.Get(i, x, y, z);
+            if (!SameBits(x, reference[i].x) || !SameBits(y, reference[i].y) ||
+                !SameBits(z, reference[i].z)) {
+                mismatches++;
+            }
+            if (std::isnan(x) || std::isnan(y) || std::isnan(z)) safeNaN++;
+        }
+
+        std::cout << "  " << GetSimdLevelName(level) << "\n";
+        std::cout << "    Normalize     : " << unsafeMs << " ms, NaN " << unsafeNaN << "개\n";
+        std::cout << "    NormalizeSafe : " << safeMs << " ms, NaN " << safeNaN
+                  << "개, 스칼라 기준과 비트 불일치 " << mismatches << "개 ("
+                  << (safeMs / unsafeMs - 1.0) * 100.0 << "% 추가 비용)\n";
+    }
+    SetSimdLevel(supported);
+
+    // BUG C 시나리오를 안전 버전으로
+    std::cout << "\n  --- BUG C 시나리오 (영벡터 이동 방향) ---\n";
+    Vector3 position(100.0f, 50.0f, 200.0f);
+    Vector3 direction(0.0f, 0.0f, 0.0f);
+    direction.NormalizeSafe(Vector3(0.0f, 0.0f, 0.0f));  // 멈춰 있으면 이동하지 않음
+    position.x += direction.x * 10.0f;
+    position.y += direction.y * 10.0f;
+    position.z += direction.z * 10.0f;
+    position.Print("이동 후 위치 (NaN 없음)");
+
+    std::cout << "\n  [결과] SIMD 레인에서는 분기 대신 blend를 쓰므로 안전성 비용이 거의 없습니다.\n";
+}
+
+// ============================================================================
+// G: 역제곱근 정밀도 모드 (InvSqrt) 비교
+// ============================================================================
+void BenchmarkInvSqrt() {
+    std::cout << "\n[G] 역제곱근 정밀도 모드 (InvSqrt) 비교\n";
+    std::cout << "  Exact / Fast(rsqrt+NR) / Approx(rsqrt)의 속도와 최대 상대 오차\n";
+    std::cout << "  (Debug 빌드에서는 수치가 크게 왜곡되므로 Release에서 측정하세요)\n\n";
+
+    // BUG D 시나리오: 같은 위치의 두 오브젝트
+    float dx = 0.0f, dz = 0.0f;
+    float distSq = dx * dx + dz * dz;
+    float invDist = InvSqrt(distSq, InvSqrtMode::Fast);
+    std::cout << "  --- BUG D 시나리오 (distSq = 0) ---\n";
+    std::cout << "  InvSqrt(0) = " << invDist << " (1/sqrt(" << kInvSqrtMinValue << ")로 클램프)\n";
+    std::cout << "  direction = (" << dx * invDist << ", " << dz * invDist << ") (NaN 없음)\n\n";
+
+    // 거리 제곱 1e-6 ~ 1e6 (로그 균등) + 약 1%는 0
+    const size_t COUNT = 4 * 1024 * 1024;
+    const int ROUNDS = 5;
+    SimdLevel supported = GetSupportedSimdLevel();
+    std::mt19937 rng(13);
+    std::uniform_real_distribution<float> exponent(-6.0f, 6.0f);
+    std::vector<float> input(COUNT), output(COUNT);
+    for (size_t i = 0; i < COUNT; i++) {
+        input[i] = (rng() % 100 == 0) ? 0.0f : powf(10.0f, exponent(rng));
+    }
+
+    // 기준: 클램프 없는 1.0f / sqrtf
+    double baseMs = MeasureBestMs(ROUNDS, [] {}, [&] {
+        for (size_t i = 0; i < COUNT; i++) output[i] = 1.0f / sqrtf(input[i]);
+    });
+    size_t infCount = 0;
+    for (float v : output) {
+        if (std::isinf(v)) infCount++;
+    }
+    std::cout << "  입력 " << COUNT << "개, 1.0f / sqrtf 루프: " << baseMs
+              << " ms, inf " << infCount << "개\n\n";
+
+    const SimdLevel levels[] = { SimdLevel::Scalar, SimdLevel::SSE41, SimdLevel::AVX2 };
+    const InvSqrtMode modes[] = { InvSqrtMode::Exact, InvSqrtMode::Fast, InvSqrtMode::Approx };
+    for (SimdLevel level : levels) {
+        if (level > supported) continue;
+        SetSimdLevel(level);
+        std::cout << "  " << GetSimdLevelName(level) << "\n";
+
+        for (InvSqrtMode mode : modes) {
+            double ms = MeasureBestMs(ROUNDS, [] {}, [&] {
+                InvSqrtBatch(input.data(), output.data(), COUNT, mode);
+            });
+
+            // 오차는 double 기준값과 비교, 단일 값 버전과는 비트 단위 비교
+            double maxRelError = 0.0;
+            size_t mismatches = 0, nonFinite = 0;
+            for (size_t i = 0; i < COUNT; i++) {
+                double x = std::max(input[i], kInvSqrtMinValue);
+                double exact = 1.0 / std::sqrt(x);
+                double relError = std::fabs(output[i] - exact) / exact;
+                if (relError > maxRelError) maxRelError = relError;
+                if (!SameBits(output[i], InvSqrt(input[i], mode))) mismatches++;
+                if (!std::isfinite(output[i])) nonFinite++;
+            }
+
+            std::cout << "    " << GetInvSqrtModeName(mode) << " : " << ms << " ms ("
+                      << baseMs / ms << "x), 최대 상대 오차 " << maxRelError
+                      << ", inf/NaN " << nonFinite << "개, 단일 값 버전과 불일치 "
+                      << mismatches << "개\n";
+        }
+    }
+    SetSimdLevel(supported);
+
+    std::cout << "\n  [결과] 모든 모드가 0 입력을 유한한 값으로 처리합니다.\n";
+    std::cout << "  오차 허용 범위에 맞춰 모드를 고르세요 (오차 한계는 InvSqrt.h 참고).\n";
+}
+
+// ============================================================================
+// H: 프레임 끝 inf/NaN 검사 (FiniteValidator)
+// ============================================================================
+// 기준 구현: 엔티티 순서 → 버퍼 순서 → 성분 순서로 하나씩 검사
+bool FindFirstNonFiniteBruteForce(const Vector3Batch* const* batches, int batchCount,
+                                  size_t& entity, int& buffer, int& component) {
+    size_t count = 0;
+    for (int b = 0; b < batchCount; b++) count = std::max(count, batches[b]->Size());
+    for (size_t i = 0; i < count; i++) {
+        for (int b = 0; b < batchCount; b++) {
+            if (i >= batches[b]->Size()) continue;
+            const float* comps[3] = { batches[b]->X(), batches[b]->Y(), batches[b]->Z() };
+            for (int c = 0; c < 3; c++) {
+                if (!std::isfinite(comps[c][i])) {
+                    entity = i; buffer = b; component = c;
+                    return true;
+                }
+            }
+        }
+    }
+    return false;
+}
+
+void BenchmarkFiniteValidator() {
+    std::cout << "\n[H] 프레임 끝 inf/NaN 검사 (FiniteValidator)\n";
+    std::cout << "  위치/속도 배열 전체를 SIMD로 훑어서 처음 오염된 엔티티를 찾습니다.\n";
+    std::cout << "  (Debug 빌드에서는 수치가 크게 왜곡되므로 Release에서 측정하세요)\n\n";
+
+    const size_t COUNT = 1024 * 1024;
+    const int ROUNDS = 10;
+    const char* componentNames[3] = { "x", "y", "z" };
+    SimdLevel supported = GetSupportedSimdLevel();
+
+    std::mt19937 rng(17);
+    std::uniform_real_distribution<float> dist(-100.0f, 100.0f);
+    Vector3Batch positions(COUNT), velocities(COUNT);
+    for (size_t i = 0; i < COUNT; i++) {
+        positions.Set(i, dist(rng), dist(rng), dist(rng));
+        velocities.Set(i, dist(rng), dist(rng), dist(rng));
+    }
+
+    FiniteValidator validator;
+    validator.Watch(&positions, "position");
+    validator.Watch(&velocities, "velocity");
+    double megaBytes = validator.BytesPerValidate() / (1024.0 * 1024.0);
+    std::cout << "  엔티티 " << COUNT << "개, 검사 대상 " << megaBytes << " MB\n\n";
+
+    // 1) 정확성: 무작위 크기(꼬리 처리 포함, 두 버퍼 크기가 다를 수 있음)에
+    //    무작위 위치의 inf/NaN을 넣고 기준 구현과 비교
+    const float poison[] = { std::numeric_limits<float>::quiet_NaN(),
+                             std::numeric_limits<float>::infinity(),
+                             -std::numeric_limits<float>::infinity() };
+    const SimdLevel levels[] = { SimdLevel::Scalar, SimdLevel::SSE41, SimdLevel::AVX2 };
+    size_t mismatches = 0, cases = 0;
+    for (SimdLevel level : levels) {
+        if (level > supported) continue;
+        SetSimdLevel(level);
+        for (int t = 0; t < 2000; t++) {
+            size_t n = rng() % 300;
+            size_t nb = (t % 2) ? n : rng() % 300;
+            Vector3Batch a(n), b(nb);
+            for (size_t i = 0; i < n; i++) a.Set(i, dist(rng), dist(rng), dist(rng));
+            for (size_t i = 0; i < nb; i++) b.Set(i, dist(rng), dist(rng), dist(rng));
+            int inject = (int)(rng() % 4);
+            for (int k = 0; k < inject; k++) {
+                Vector3Batch& target = (rng() % 2) ? a : b;
+                if (target.Size() == 0) continue;
+                float* comps[3] = { target.X(), target.Y(), target.Z() };
+                comps[rng() % 3][rng() % target.Size()] = poison[rng() % 3];
+            }
+
+            FiniteValidator v;
+            v.Watch(&a, "a");
+            v.Watch(&b, "b");
+            NonFiniteReport report;
+            bool ok = v.Validate(&report);
+
+            const Vector3Batch* batches[2] = { &a, &b };
+            size_t entity = 0;
+            int buffer = 0, component = 0;
+            bool expectedFound = FindFirstNonFiniteBruteForce(batches, 2, entity, buffer, component);
+            bool same = (ok == !expectedFound);
+            if (same && expectedFound) {
+                same = report.entity == entity && report.component == component &&
+                       strcmp(report.bufferName, buffer == 0 ? "a" : "b") == 0;
+            }
+            if (!same) mismatches++;
+            cases++;
+        }
+    }
+    std::cout << "  무작위 검증 " << cases << "건, 기준 구현과 불일치 " << mismatches << "건\n";
+
+    // 큰 버퍼 뒤쪽에서 찾은 뒤, 뒤에 등록한 작은 버퍼는 자기 크기까지만 읽어야 함
+    {
+        Vector3Batch large(10000), small(100);
+        for (size_t i = 0; i < large.Size(); i++) large.Set(i, 1.0f, 2.0f, 3.0f);
+        for (size_t i = 0; i < small.Size(); i++) small.Set(i, 1.0f, 2.0f, 3.0f);
+        large.Y()[5000] = std::numeric_limits<float>::quiet_NaN();
+        small.Z()[42] = std::numeric_limits<float>::infinity();
+
+        FiniteValidator v;
+        v.Watch(&large, "large");
+        v.Watch(&small, "small");
+        NonFiniteReport report;
+        bool found = !v.Validate(&report);
+        bool correct = found && report.entity == 42 && report.component == 2 &&
+                       strcmp(report.bufferName, "small") == 0;
+        std::cout << "  크기가 다른 버퍼 (10000개[5000].y NaN, 100개[42].z inf): "
+                  << (found ? report.bufferName : "없음") << "[" << report.entity << "]."
+                  << componentNames[report.component] << " → " << (correct ? "정상" : "틀림!") << "\n\n";
+    }
+
+    // 2) 비용: 한 프레임의 이동(pos += vel * dt)과 검사 시간 비교
+    for (SimdLevel level : levels) {
+        if (level > supported) continue;
+        SetSimdLevel(level);
+
+        double updateMs = MeasureBestMs(ROUNDS, [] {}, [&] {
+            Vector3Ops::MulAdd(positions, velocities, 0.0f, positions);
+        });
+        bool allFinite = true;
+        double validateMs = MeasureBestMs(ROUNDS, [] {}, [&] {
+            allFinite = validator.Validate();
+        });
+
+        std::cout << "  " << GetSimdLevelName(level) << " : 이동 " << updateMs << " ms, 검사 "
+                  << validateMs << " ms (" << megaBytes / 1024.0 / (validateMs / 1000.0)
+                  << " GB/s, 이동 대비 " << validateMs / updateMs * 100.0 << "%), "
+                  << (allFinite ? "모두 유한" : "오염 발견") << "\n";
+    }
+    SetSimdLevel(supported);
+
+    // 3) BUG D 시나리오: 같은 위치의 적이 inf 방향으로 속도를 받음
+    std::cout << "\n  --- BUG D 시나리오 (엔티티 777777이 같은 위치의 적을 추적) ---\n";
+    size_t victim = 777777;
+    float invDist = 1.0f / sqrtf(0.0f);         // inf
+    velocities.Y()[victim] = 0.0f * invDist;    // NaN
+    velocities.X()[victim] = 5.0f * invDist;    // inf
+    Vector3Ops::MulAdd(positions, velocities, 0.016f, positions);
+
+    NonFiniteReport report;
+    if (!validator.Validate(&report)) {
+        std::cout << "  프레임 끝 검사: " << report.bufferName << "[" << report.entity << "]."
+                  << componentNames[report.component] << " = " << report.value << "\n";
+    }
+
+    std::cout << "\n  [결과] 오염된 프레임에서 바로 엔티티를 찾아냅니다.\n";
+    std::cout << "  검사 비용은 배열을 한 번 읽는 정도라서 릴리스에서도 켜 둘 수 있습니다.\n";
+}
+
+// ============================================================================
+// I: SoA 스프라이트 애니메이션 일괄 갱신 (SpriteAnimationSystem)
+// ============================================================================
+// 비교용: 스프라이트 하나씩, 갱신할 때마다 fps로 나누는 방식 (SpriteSheet 스타일)
+struct NaiveSprite {
+    float fps;
+    int frameCount;
+    bool loop;
+    int frame = 0;
+    float accumulator = 0.0f;
+
+    void Update(float dt) {
+        float frameTime = 1.0f / fps;   // 매번 나눗셈 (fps == 0이면 inf)
+        accumulator += dt;
+        while (accumulator >= frameTime) {
+            accumulator -= frameTime;
+            if (frame + 1 < frameCount) frame++;
+            else if (loop) frame = 0;
+        }
+    }
+};
+
+void BenchmarkSpriteAnimation() {
+    std::cout << "\n[I] SoA 스프라이트 애니메이션 일괄 갱신 (SpriteAnimationSystem)\n";
+    std::cout << "  fps는 등록 시 한 번만 검사하고, 갱신 루프에는 나눗셈이 없습니다.\n";
+    std::cout << "  (Debug 빌드에서는 수치가 크게 왜곡되므로 Release에서 측정하세요)\n\n";
+
+    // 1) 등록 시점 검증 - BUG A의 fps = 0 시트는 여기서 걸러짐
+    std::cout << "  --- 등록 시점 fps 검사 ---\n";
+    SpriteAnimationSystem validation;
+    SpriteSheet sheet;  // fps = 0.0f (BUG A)
+    const float testFps[] = { sheet.fps, -5.0f, std::numeric_limits<float>::quiet_NaN(),
+                              std::numeric_limits<float>::infinity(), 24.0f };
+    for (float fps : testFps) {
+        SpriteClip clip;
+        clip.frameCount = sheet.frameCount;
+        clip.fps = fps;
+        size_t id = validation.AddSprite(clip);
+        std::cout << "    fps = " << fps << " → "
+                  << (id == SpriteAnimationSystem::kInvalidSprite ? "거부" : "등록") << "\n";
+    }
+
+    // 2) 무작위 스프라이트 설정
+    const size_t COUNT = 200 * 1000;
+    const int FRAMES = 60;
+    const int ROUNDS = 5;
+    const float DT = 1.0f / 60.0f;
+    SimdLevel supported = GetSupportedSimdLevel();
+
+    std::mt19937 rng(19);
+    std::vector<SpriteClip> clips(COUNT);
+    for (SpriteClip& clip : clips) {
+        clip.frameCount = 4 + (int)(rng() % 61);
+        clip.fps = 6.0f + (float)(rng() % 55);
+        clip.loop = (rng() % 10) != 0;
+    }
+
+    std::vector<NaiveSprite> naive(COUNT);
+    double naiveMs = MeasureBestMs(ROUNDS, [&] {
+        for (size_t i = 0; i < COUNT; i++) {
+            naive[i] = NaiveSprite{ clips[i].fps, clips[i].frameCount, clips[i].loop };
+        }
+    }, [&] {
+        for (int f = 0; f < FRAMES; f++) {
+            for (NaiveSprite& sprite : naive) sprite.Update(DT);
+        }
+    });
+    std::cout << "\n  스프라이트 " << COUNT << "개 × " << FRAMES << "프레임\n";
+    std::cout << "  스프라이트별 Update (매번 1/fps) : " << naiveMs / FRAMES << " ms/프레임\n";
+
+    // 3) 단계별 SoA 커널. 히치(dt 0.5초)를 섞어서 돌린 결과를 Scalar와 비트 단위로 비교
+    std::vector<int> refFrames;
+    std::vector<float> refAccumulators;
+    const SimdLevel levels[] = { SimdLevel::Scalar, SimdLevel::SSE41, SimdLevel::AVX2 };
+    for (SimdLevel level : levels) {
+        if (level > supported) continue;
+        SetSimdLevel(level);
+
+        SpriteAnimationSystem system;
+        double ms = MeasureBestMs(ROUNDS, [&] {
+            system.Clear();
+            system.Reserve(COUNT);
+            for (const SpriteClip& clip : clips) system.AddSprite(clip);
+        }, [&] {
+            for (int f = 0; f < FRAMES; f++) system.Update(DT);
+        });
+
+        for (int f = 0; f < 300; f++) {
+            system.Update(f % 97 == 0 ? 0.5f : DT * (0.5f + (float)(f % 7) * 0.25f));
+        }
+        size_t mismatches = 0, outOfRange = 0;
+        if (refFrames.empty()) {
+            for (size_t i = 0; i < COUNT; i++) {
+                refFrames.push_back(system.GetFrame(i));
+                refAccumulators.push_back(system.GetAccumulator(i));
+            }
+        }
+        for (size_t i = 0; i < COUNT; i++) {
+            if (system.GetFrame(i) != refFrames[i] ||
+                !SameBits(system.GetAccumulator(i), refAccumulators[i])) {
+                mismatches++;
+            }
+            if (system.GetFrame(i) < 0 || system.GetFrame(i) >= clips[i].frameCount) outOfRange++;
+        }
+
+        double perFrame = ms / FRAMES;
+        std::cout << "  SoA " << GetSimdLevelName(level) << " : " << perFrame << " ms/프레임 ("
+                  << naiveMs / ms << "x, 초당 " << COUNT / (perFrame / 1000.0) / 1e6
+                  << "M 스프라이트), Scalar와 불일치 " << mismatches << "개, 범위 밖 프레임 "
+                  << outOfRange << "개\n";
+    }
+    SetSimdLevel(supported);
+
+    std::cout << "\n  [결과] 잘못된 fps는 등록할 때 거부되고, 갱신은 나눗셈 없이 한 번에 처리됩니다.\n";
+}
+
+// ============================================================================
+// J: 캐시된 카메라 행렬과 SIMD 절두체 컬링
+// ============================================================================
+void BenchmarkCameraCulling() {
+    std::cout << "\n[J] 캐시된 카메라 행렬과 SIMD 절두체 컬링\n";
+    std::cout << "  행렬은 값이 바뀐 경우에만 다시 계산하고, 구 1M개를 6개 평면으로 컬링합니다.\n";
+    std::cout << "  (Debug 빌드에서는 수치가 크게 왜곡되므로 Release에서 측정하세요)\n\n";
+
+    // 1) 설정 시점 검사와 캐시 - BUG A의 height = 0은 여기서 거부
+    std::cout << "  --- 카메라 캐시 ---\n";
+    CachedCamera camera;
+    Camera bugCamera;   // screenHeight = 0 (BUG A)
+    bool accepted = camera.SetViewport(bugCamera.screenWidth, bugCamera.screenHeight);
+    std::cout << "    SetViewport(" << bugCamera.screenWidth << ", " << bugCamera.screenHeight
+              << ") → " << (accepted ? "적용" : "거부") << ", aspect = "
+              << camera.GetAspectRatio() << "\n";
+
+    camera.SetViewport(1920, 1080);
+    camera.SetPerspective(3.14159265f / 3.0f, 0.1f, 1000.0f);
+    float checksum = 0.0f;
+    for (int i = 0; i < 1000000; i++) {
+        checksum += camera.GetViewProjection().m[0][0] + camera.GetAspectRatio();
+    }
+    std::cout << "    GetViewProjection/GetAspectRatio 100만 회 → 다시 계산 "
+              << camera.GetViewProjectionRebuildCount() << "회 (checksum " << checksum << ")\n";
+
+    // 카메라가 매 프레임 회전: 뷰만 바뀌므로 프로젝션은 다시 계산하지 않음
+    for (int frame = 0; frame < 60; frame++) {
+        float angle = frame * 0.01f;
+        camera.SetLookAt({ 0.0f, 0.0f, 0.0f }, { sinf(angle), 0.0f, cosf(angle) },
+                         { 0.0f, 1.0f, 0.0f });
+        camera.GetFrustum();
+    }
+    std::cout << "    60프레임 회전 후: 뷰-프로젝션 " << camera.GetViewProjectionRebuildCount()
+              << "회, 프로젝션 " << camera.GetProjectionRebuildCount() << "회 계산\n\n";
+
+    // 2) 컬링
+    camera.SetLookAt({ 0.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, 1.0f }, { 0.0f, 1.0f, 0.0f });
+    const Frustum& frustum = camera.GetFrustum();
+
+    const size_t COUNT = 1024 * 1024;
+    const int ROUNDS = 10;
+    SimdLevel supported = GetSupportedSimdLevel();
+    std::mt19937 rng(23);
+    std::uniform_real_distribution<float> pos(-500.0f, 500.0f);
+    std::uniform_real_distribution<float> rad(0.5f, 5.0f);
+    Vector3Batch centers(COUNT);
+    AlignedFloatArray radii(COUNT);
+    for (size_t i = 0; i < COUNT; i++) {
+        centers.Set(i, pos(rng), pos(rng), pos(rng));
+        radii[i] = rad(rng);
+    }
+
+    std::cout << "  --- 절두체 컬링 (구 " << COUNT << "개, 단일 스레드) ---\n";
+    std::vector<uint32_t> visible(COUNT), reference;
+    const SimdLevel levels[] = { SimdLevel::Scalar, SimdLevel::SSE41, SimdLevel::AVX2 };
+    for (SimdLevel level : levels) {
+        if (level > supported) continue;
+        SetSimdLevel(level);
+
+        size_t visibleCount = 0;
+        double ms = MeasureBestMs(ROUNDS, [] {}, [&] {
+            visibleCount = CullSpheres(frustum, centers, radii.data(), visible.data());
+        });
+
+        if (reference.empty()) reference.assign(visible.begin(), visible.begin() + visibleCount);
+        bool same = visibleCount == reference.size() &&
+                    std::equal(reference.begin(), reference.end(), visible.begin());
+
+        double seconds = ms / 1000.0;
+        std::cout << "    " << GetSimdLevelName(level) << " : " << ms << " ms, 코어당 "
+                  << COUNT / seconds / 1e6 << "M 구/초 ("
+                  << COUNT * 4 * sizeof(float) / seconds / 1e9 << " GB/s), 보이는 구 "
+                  << visibleCount << "개, Scalar와 " << (same ? "동일" : "다름!") << "\n";
+    }
+    SetSimdLevel(supported);
+
+    std::cout << "\n  [결과] 잘못된 뷰포트는 설정할 때 거부되고, 행렬은 바뀔 때만 계산됩니다.\n";
+    std::cout << "  컬링 결과는 보이는 인덱스만 빈틈없이 담긴 목록이라 바로 드로우에 쓸 수 있습니다.\n";
+}
+
+// ============================================================================
+// K: 곱셈 기반 정수 나눗셈 (FastDivider)
+// ============================================================================
+// q가 n / d(0 방향 버림)의 올바른 몫인지 64비트로 확인 (분기 없이 - 2^32번 호출됨)
+inline bool IsCorrectQuotient(int64_t n, int64_t d, int64_t q) {
+    int64_t r = n - q * d;
+    int64_t absR = r < 0 ? -r : r;
+    int64_t absD = d < 0 ? -d : d;
+    return (absR < absD) & ((r == 0) | ((r ^ n) >= 0));
+}
+
+// 분자 2^32개 전체를 DivideBatch로 나누고 확인. 틀린 개수를 돌려줌
+template <typename T>
+uint64_t CheckAllNumerators(T divisor) {
+    const size_t CHUNK = 1 << 16;
+    std::vector<T> in(CHUNK), out(CHUNK);
+    FastDivider<T> divider(divisor);
+    uint64_t errors = 0;
+    for (uint64_t base = 0; base < (1ull << 32); base += CHUNK) {
+        for (size_t i = 0; i < CHUNK; i++) in[i] = (T)(uint32_t)(base + i);
+        divider.DivideBatch(in.data(), out.data(), CHUNK);
+        for (size_t i = 0; i < CHUNK; i++) {
+            errors += !IsCorrectQuotient((int64_t)in[i], (int64_t)divisor, (int64_t)out[i]);
+        }
+    }
+    // INT32_MIN / -1은 오버플로라서 정의상 INT32_MIN을 돌려줌 (위 검사에서는 오류로 셈)
+    if (std::is_signed<T>::value && divisor == (T)-1) {
+        T minValue = std::numeric_limits<T>::min();
+        if (divider.Divide(minValue) == minValue) errors--;
+    }
+    return errors;
+}
+
+// 많은 제수에 대해 경계값 + 무작위 분자를 Divide / DivideBatch(현재 단계)로 확인
+template <typename T>
+uint64_t CheckManyDivisors(const std::vector<T>& divisors, std::mt19937& rng) {
+    std::vector<T> in, out;
+    uint64_t errors = 0;
+    for (T d : divisors) {
+        FastDivider<T> divider(d);
+        const T edges[] = { 0, 1, 2, (T)(d - 1), d, (T)(d + 1), (T)(d * 2), (T)(d * 2 - 1),
+                            std::numeric_limits<T>::max(), std::numeric_limits<T>::min(),
+                            (T)(std::numeric_limits<T>::max() - 1), (T)(std::numeric_limits<T>::min() + 1) };
+        in.assign(std::begin(edges), std::end(edges));
+        for (int k = 0; k < 52; k++) in.push_back((T)rng());
+        out.resize(in.size());
+        divider.DivideBatch(in.data(), out.data(), in.size());
+        for (size_t i = 0; i < in.size(); i++) {
+            if (std::is_signed<T>::value && d == (T)-1 && in[i] == std::numeric_limits<T>::min()) {
+                errors += out[i] != in[i] || divider.Divide(in[i]) != in[i];
+                continue;
+            }
+            T expected = in[i] / d;
+            errors += out[i] != expected;
+            errors += divider.Divide(in[i]) != expected;
+        }
+    }
+    return errors;
+}
+
+void BenchmarkFastDivider() {
+    std::cout << "\n[K] 곱셈 기반 정수 나눗셈 (FastDivider)\n";
+    std::cout << "  같은 제수로 여러 번 나눌 때 매직 넘버 곱셈 + 시프트로 바꿉니다.\n";
+    std::cout << "  (Debug 빌드에서는 수치가 크게 왜곡되므로 Release에서 측정하세요)\n\n";
+
+    // 1) BUG B 시나리오: 0은 생성 시점에 거부
+    std::cout << "  --- BUG B 시나리오 (teamCount = 0) ---\n";
+    int teamCount = 0;
+    try {
+        FastDivider<int32_t> perTeam(teamCount);
+        std::cout << "    생성됨 (있으면 안 됨!)\n";
+    } catch (const std::invalid_argument& e) {
+        std::cout << "    생성 시 거부: " << e.what() << " (크래시 없음)\n";
+    }
+    teamCount = 3;
+    FastDivider<int32_t> perTeam(teamCount);
+    std::cout << "    teamCount = 3 → 100 / perTeam = " << 100 / perTeam << "\n\n";
+
+    SimdLevel supported = GetSupportedSimdLevel();
+    const SimdLevel levels[] = { SimdLevel::Scalar, SimdLevel::SSE41, SimdLevel::AVX2 };
+    std::mt19937 rng(29);
+
+    // 2) 분자 전체(2^32개) 검사 - 매직 넘버 경로(시프트/곱셈/덧셈 보정)를 모두 포함
+    std::cout << "  --- 분자 2^32개 전체 검사 (" << GetSimdLevelName(supported)
+              << ", 제수당 10초 안팎 걸립니다) ---\n";
+    const uint32_t unsignedDivisors[] = { 7, 641 };
+    const int32_t signedDivisors[] = { -7, -1000 };
+    for (uint32_t d : unsignedDivisors) {
+        auto start = std::chrono::steady_clock::now();
+        uint64_t errors = CheckAllNumerators<uint32_t>(d);
+        double sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        std::cout << "    uint32 / " << d << " : 오류 " << errors << "개 (" << sec << " s)\n";
+    }
+    for (int32_t d : signedDivisors) {
+        auto start = std::chrono::steady_clock::now();
+        uint64_t errors = CheckAllNumerators<int32_t>(d);
+        double sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        std::cout << "    int32  / " << d << " : 오류 " << errors << "개 (" << sec << " s)\n";
+    }
+
+    // 3) 제수 ±1 ~ ±65536 전체 + 무작위 제수 10만 개, 단계별 비교
+    std::vector<uint32_t> uDivisors;
+    std::vector<int32_t> sDivisors;
+    for (uint32_t d = 1; d <= 65536; d++) {
+        uDivisors.push_back(d);
+        sDivisors.push_back((int32_t)d);
+        sDivisors.push_back(-(int32_t)d);
+    }
+    for (int k = 0; k < 100000; k++) {
+        // 크기가 고르게 섞이도록 무작위로 시프트 (0은 제외)
+        uint32_t d = (uint32_t)rng() >> (rng() % 32);
+        uDivisors.push_back(d ? d : 1u);
+        sDivisors.push_back(d ? (int32_t)d : -1);
+    }
+    uDivisors.push_back(0x80000001u);
+    uDivisors.push_back(0xFFFFFFFFu);
+    sDivisors.push_back(std::numeric_limits<int32_t>::max());
+    sDivisors.push_back(std::numeric_limits<int32_t>::min());
+    std::cout << "\n  --- 제수 " << uDivisors.size() + sDivisors.size()
+              << "개 × 분자 64개 (경계값 + 무작위) ---\n";
+    for (SimdLevel level : levels) {
+        if (level > supported) continue;
+        SetSimdLevel(level);
+        uint64_t errors = CheckManyDivisors(uDivisors, rng) + CheckManyDivisors(sDivisors, rng);
+        std::cout << "    " << GetSimdLevelName(level) << " : '/' 연산자와 불일치 " << errors << "개\n";
+    }
+
+    // 4) 처리량: 실행 중에 정해지는 제수로 1600만 개 나누기
+    const size_t COUNT = 16 * 1024 * 1024;
+    const int ROUNDS = 5;
+    int32_t divisor = 3 + (int32_t)(rng() % 1000);
+    std::vector<int32_t> numerators(COUNT), quotients(COUNT);
+    for (int32_t& n : numerators) n = (int32_t)rng();
+    FastDivider<int32_t> divider(divisor);
+
+    std::cout << "\n  --- 처리량 (int32, 제수 " << divisor << ", " << COUNT << "개) ---\n";
+    double idivMs = MeasureBestMs(ROUNDS, [] {}, [&] {
+        for (size_t i = 0; i < COUNT; i++) quotients[i] = numerators[i] / divisor;
+    });
+    std::cout << "    하드웨어 idiv        : " << idivMs << " ms\n";
+    double scalarMs = MeasureBestMs(ROUNDS, [] {}, [&] {
+        for (size_t i = 0; i < COUNT; i++) quotients[i] = numerators[i] / divider;
+    });
+    std::cout << "    FastDivider::Divide  : " << scalarMs << " ms (" << idivMs / scalarMs << "x)\n";
+    for (SimdLevel level : levels) {
+        if (level > supported) continue;
+        SetSimdLevel(level);
+        double ms = MeasureBestMs(ROUNDS, [] {}, [&] {
+            divider.DivideBatch(numerators.data(), quotients.data(), COUNT);
+        });
+        std::cout << "    DivideBatch " << GetSimdLevelName(level) << " : " << ms << " ms ("
+                  << idivMs / ms << "x, " << COUNT / (ms / 1000.0) / 1e9 << " G나눗셈/초)\n";
+    }
+    SetSimdLevel(supported);
+
+    std::cout << "\n  [결과] 제수 0은 생성할 때 걸러지고, 나눗셈은 곱셈 + 시프트로 바뀝니다.\n";
+}
+
 // ============================================================================
 // 메인
 // ============================================================================
@@ -168,6 +948,13 @@ int main() {
     std::cout << "  [B] 정수 0 나누기 (즉시 크래시!)\n";
     std::cout << "  [C] NaN 전파 (영벡터 정규화)\n";
     std::cout << "  [D] 거리 계산에서 매우 작은 값\n";
+    std::cout << "  [E] SoA Vector3Batch 일괄 연산 벤치마크\n";
+    std::cout << "  [F] 분기 없는 안전 정규화 (NormalizeSafe)\n";
+    std::cout << "  [G] 역제곱근 정밀도 모드 (InvSqrt) 비교\n";
+    std::cout << "  [H] 프레임 끝 inf/NaN 검사 (FiniteValidator)\n";
+    std::cout << "  [I] SoA 스프라이트 애니메이션 일괄 갱신\n";
+    std::cout << "  [J] 캐시된 카메라 행렬과 SIMD 절두체 컬링\n";
+    std::cout << "  [K] 곱셈 기반 정수 나눗셈 (FastDivider)\n";
     std::cout << "  [Q] 종료\n";
     std::cout << "----------------------------------------------------\n";
 
@@ -182,6 +969,13 @@ int main() {
         case 'B': BugB_IntegerDivisionByZero(); break;
         case 'C': BugC_NaNPropagation(); break;
         case 'D': BugD_NearZeroDistance(); break;
+        case 'E': BenchmarkVector3Batch(); break;
+        case 'F': BenchmarkNormalizeSafe(); break;
+        case 'G': BenchmarkInvSqrt(); break;
+        case 'H': BenchmarkFiniteValidator(); break;
+        case 'I': BenchmarkSpriteAnimation(); break;
+        case 'J': BenchmarkCameraCulling(); break;
+        case 'K': BenchmarkFastDivider(); break;
         case 'Q': std::cout << "종료합니다.\n"; return 0;
         default:  std::cout << "잘못된 입력입니다.\n"; break;
         }
@@ -0,0 +1,68 @@
+/*============================================================================
+ *  BoneUploadRing.cpp - 프레임 영역 선형 할당과 스트리밍 저장
+ *============================================================================*/
+#include "BoneUploadRing.h"
+
+#include <cassert>
+#include <cstring>
+#include <new>
+
+#include <emmintrin.h>
+
+namespace {
+
+constexpr size_t kBufferAlignment = 64;
+
+} // namespace
+
+BoneUploadRing::BoneUploadRing(uint32_t matricesPerFrame)
+    : m_Data(nullptr), m_MatricesPerFrame(matricesPerFrame), m_FrameBase(0), m_Cursor(0),
+      m_FrameNumber(0) {
+    assert(matricesPerFrame > 0 && (uint64_t)matricesPerFrame * kFrameCount <= 0xFFFFFFFFu);
+    size_t bytes = (size_t)matricesPerFrame * kFrameCount * kFloatsPerMatrix * sizeof(float);
+    m_Data = static_cast<float*>(::operator new(bytes, std::align_val_t(kBufferAlignment)));
+    memset(m_Data, 0, bytes);
+}
+
+BoneUploadRing::~BoneUploadRing() {
+    ::operator delete(m_Data, std::align_val_t(kBufferAlignment));
+}
+
+void BoneUploadRing::BeginFrame() {
+    m_FrameNumber++;
+    m_FrameBase = (uint32_t)(m_FrameNumber % kFrameCount) * m_MatricesPerFrame;
+    m_Cursor = 0;
+}
+
+BonePaletteHandle BoneUploadRing::Allocate(uint32_t boneCount) {
+    BonePaletteHandle handle;
+    if (boneCount == 0 || boneCount > m_MatricesPerFrame - m_Cursor) return handle;
+    handle.offset = m_FrameBase + m_Cursor;
+    handle.count = boneCount;
+    m_Cursor += boneCount;
+    return handle;
+}
+
+void BoneUploadRing::WritePalette(const BonePaletteHandle& handle, const float* source) {
+    assert(handle.count > 0 && handle.offset >= m_FrameBase &&
+           handle.offset + handle.count <= m_FrameBase + m_Cursor);
+
+    // 행렬 하나 = 64바이트 = 캐시 라인 하나. 버퍼가 64바이트 정렬이므로 모든 팔레트도 정렬됨
+    float* dest = GetPalette(handle);
+    size_t floats = (size_t)handle.count * kFloatsPerMatrix;
+    for (size_t i = 0; i < floats; i += 16) {
+        __m128 a = _mm_loadu_ps(source + i);
+        __m128 b = _mm_loadu_ps(source + i + 4);
+        __m128 c = _mm_loadu_ps(source + i + 8);
+        __m128 d = _mm_loadu_ps(source + i + 12);
+        _mm_stream_ps(dest + i, a);
+        _mm_stream_ps(dest + i + 4, b);
+        _mm_stream_ps(dest + i + 8, c);
+        _mm_stream_ps(dest + i + 12, d);
+    }
+}
+
+void BoneUploadRing::EndFrame() {
+    // 스트리밍 저장은 순서가 보장되지 않으므로 넘기기 전에 모두 반영
+    _mm_sfence();
+}
@@ -0,0 +1,83 @@
+/*============================================================================
+ *  BoneUploadRing - 프레임 링(3중 버퍼) 본 행렬 업로드 버퍼
+ *  ---------------------------------------------------------------------------
+ *  BUG C의 RenderItem::boneMatrices는 항목마다 따로 잡은 float 배열을 가리킵니다.
+ *  매 프레임 캐릭터마다 malloc/free가 일어나고, GPU에 올리기 전에
+ *  흩어진 배열을 다시 한 곳으로 모아야 합니다.
+ *
+ *  BoneUploadRing은 버퍼 하나를 프레임 영역 3개로 나눕니다:
+ *
+ *      [ 프레임 0 영역 | 프레임 1 영역 | 프레임 2 영역 ]
+ *                        ^ BeginFrame()마다 다음 영역으로 이동, 커서 0으로
+ *
+ *  Allocate(boneCount)는 현재 영역에서 커서만 밀어서 팔레트를 잘라 주고
+ *  버퍼 시작 기준 행렬 오프셋(BonePaletteHandle)을 돌려줍니다.
+ *  이 오프셋은 RenderItemPool::SetBones()에 그대로 넣을 수 있고,
+ *  모든 캐릭터의 팔레트가 한 버퍼에 연속으로 놓이므로 프레임 영역 통째로 올리면 됩니다.
+ *
+ *  WritePalette()는 스트리밍 저장(_mm_stream_ps)으로 캐시를 거치지 않고 씁니다.
+ *  CPU가 다시 읽지 않는 업로드 데이터라 캐시를 더럽히지 않는 편이 유리합니다.
+ *  EndFrame()의 sfence 이후에 영역을 GPU/다른 스레드에 넘기세요.
+ *
+ *  3개 영역을 돌려 쓰므로 BeginFrame() 전에 GPU가 3프레임 전 영역을 다 읽었는지
+ *  (펜스) 확인하는 것은 호출 측 책임입니다.
+ *============================================================================*/
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// 버퍼 시작 기준 행렬 단위 위치. count == 0이면 무효 (공간 부족)
+struct BonePaletteHandle {
+    uint32_t offset = 0;
+    uint32_t count = 0;
+};
+
+class BoneUploadRing {
+public:
+    static constexpr uint32_t kFrameCount      = 3;
+    static constexpr uint32_t kFloatsPerMatrix = 16;
+
+    // 프레임당 행렬 matricesPerFrame개 x 3 영역을 64바이트 정렬로 확보
+    explicit BoneUploadRing(uint32_t matricesPerFrame);
+    ~BoneUploadRing();
+
+    BoneUploadRing(const BoneUploadRing&) = delete;
+    BoneUploadRing& operator=(const BoneUploadRing&) = delete;
+
+    // 다음 프레임 영역으로 이동하고 비움 (malloc 없음)
+    void BeginFrame();
+
+    // 현재 영역에서 팔레트 boneCount개를 잘라 줌. 공간이 모자라면 count 0 핸들
+    BonePaletteHandle Allocate(uint32_t boneCount);
+
+    // 팔레트에 직접 쓰기 (일반 저장)
+    float* GetPalette(const BonePaletteHandle& handle) {
+        return m_Data + (size_t)handle.offset * kFloatsPerMatrix;
+    }
+
+    // source(행렬 handle.count개)를 스트리밍 저장으로 복사
+    void WritePalette(const BonePaletteHandle& handle, const float* source);
+
+    // 스트리밍 저장을 마무리 (sfence). 이후 현재 영역을 업로드
+    void EndFrame();
+
+    // 현재 프레임 영역 (업로드 대상)
+    const float* GetFrameData() const {
+        return m_Data + (size_t)m_FrameBase * kFloatsPerMatrix;
+    }
+    uint32_t GetFrameBase() const { return m_FrameBase; }
+    uint32_t GetUsedMatrices() const { return m_Cursor; }
+    uint32_t GetMatricesPerFrame() const { return m_MatricesPerFrame; }
+    uint64_t GetFrameNumber() const { return m_FrameNumber; }
+
+    // 버퍼 전체 (GPU 쪽에서 handle.offset으로 읽는 버퍼)
+    const float* GetData() const { return m_Data; }
+
+private:
+    float*   m_Data;
+    uint32_t m_MatricesPerFrame;
+    uint32_t m_FrameBase;           // 현재 영역의 시작 행렬 오프셋
+    uint32_t m_Cursor;              // 현재 영역에서 쓴 행렬 수
+    uint64_t m_FrameNumber;
+};
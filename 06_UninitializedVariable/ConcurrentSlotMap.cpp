@@ -0,0 +1,86 @@
+/*============================================================================
+ *  ConcurrentSlotMap.cpp - 슬롯 발급/반납과 태그 붙은 빈 슬롯 스택
+ *============================================================================*/
+#include "ConcurrentSlotMap.h"
+
+#include <cassert>
+
+ConcurrentSlotMap::ConcurrentSlotMap(uint32_t capacity)
+    : m_Slots(new std::atomic<uint64_t>[capacity]),
+      m_Next(new std::atomic<uint32_t>[capacity]),
+      m_FreeHead(0),
+      m_Capacity(capacity) {
+    assert(capacity > 0 && capacity < kEndOfList);
+
+    // 모든 슬롯: generation 0, 포인터 없음. 빈 슬롯 목록은 0 → 1 → ... 순서
+    for (uint32_t i = 0; i < capacity; i++) {
+        m_Slots[i].store(0, std::memory_order_relaxed);
+        m_Next[i].store(i + 1 < capacity ? i + 1 : kEndOfList, std::memory_order_relaxed);
+    }
+    m_FreeHead.store(0, std::memory_order_release);
+}
+
+SlotHandle ConcurrentSlotMap::Create(void* ptr) {
+    uintptr_t bits = reinterpret_cast<uintptr_t>(ptr);
+    assert(ptr != nullptr && (static_cast<uint64_t>(bits) >> kPointerBits) == 0);
+
+    uint32_t index;
+    if (!PopFree(index)) return SlotHandle();
+
+    // 꺼낸 슬롯은 이 스레드만 씀. generation을 올리고 포인터와 함께 한 번에 공개
+    uint64_t old = m_Slots[index].load(std::memory_order_relaxed);
+    uint32_t generation = static_cast<uint32_t>(old >> kPointerBits) + 1;
+    assert(generation <= kMaxGeneration && "은퇴한 슬롯이 빈 슬롯 목록에 있습니다");
+    m_Slots[index].store((static_cast<uint64_t>(generation) << kPointerBits) | bits,
+                         std::memory_order_release);
+
+    SlotHandle handle;
+    handle.index = index;
+    handle.generation = generation;
+    return handle;
+}
+
+bool ConcurrentSlotMap::Destroy(const SlotHandle& handle) {
+    if (handle.index >= m_Capacity || handle.generation == 0) return false;
+
+    std::atomic<uint64_t>& slot = m_Slots[handle.index];
+    uint64_t expected = slot.load(std::memory_order_acquire);
+    if ((expected >> kPointerBits) != handle.generation || (expected & kPointerMask) == 0) {
+        return false;
+    }
+    // generation은 남기고 포인터만 지움. 동시에 지우려는 스레드 중 하나만 성공
+    if (!slot.compare_exchange_strong(expected, expected & ~kPointerMask,
+                                      std::memory_order_acq_rel, std::memory_order_acquire)) {
+        return false;
+    }
+    // generation을 다 쓴 슬롯은 은퇴. 다시 발급하면 1부터 돌아 오래된 핸들이 살아남
+    if (handle.generation < kMaxGeneration) PushFree(handle.index);
+    return true;
+}
+
+bool ConcurrentSlotMap::PopFree(uint32_t& index) {
+    uint64_t head = m_FreeHead.load(std::memory_order_acquire);
+    for (;;) {
+        uint32_t top = static_cast<uint32_t>(head);
+        if (top == kEndOfList) return false;
+
+        // 다른 스레드가 top을 먼저 꺼냈다면 next는 틀릴 수 있지만, 태그가 바뀌어 CAS가 실패함
+        uint32_t next = m_Next[top].load(std::memory_order_relaxed);
+        uint64_t newHead = (((head >> 32) + 1) << 32) | next;
+        if (m_FreeHead.compare_exchange_weak(head, newHead, std::memory_order_acq_rel,
+                                             std::memory_order_acquire)) {
+            index = top;
+            return true;
+        }
+    }
+}
+
+void ConcurrentSlotMap::PushFree(uint32_t index) {
+    uint64_t head = m_FreeHead.load(std::memory_order_relaxed);
+    uint64_t newHead;
+    do {
+        m_Next[index].store(static_cast<uint32_t>(head), std::memory_order_relaxed);
+        newHead = (((head >> 32) + 1) << 32) | index;
+    } while (!m_FreeHead.compare_exchange_weak(head, newHead, std::memory_order_release,
+                                               std::memory_order_relaxed));
+}
@@ -0,0 +1,78 @@
+/*============================================================================
+ *  ConcurrentSlotMap - 여러 스레드에서 핸들을 해석하는 lock-free 슬롯 맵
+ *  ---------------------------------------------------------------------------
+ *  BUG D의 IsHandleValid는 Slot의 ptr과 generation을 따로 읽습니다.
+ *  한 스레드에서만 쓰면 괜찮지만, 메인 스레드가 객체를 만들고 지우는 동안
+ *  워커 스레드가 핸들을 해석하면 "generation은 옛것, ptr은 새것"을 읽을 수 있습니다.
+ *
+ *  여기서는 슬롯 하나를 64비트 원자 워드 하나로 묶습니다:
+ *
+ *      [ generation 16비트 | 포인터 48비트 ]   (x64 사용자 주소는 47비트 이내)
+ *
+ *  - Resolve(): 원자 로드 1번 + 비교 → 재시도 없음 (wait-free)
+ *  - Destroy(): CAS로 포인터만 지움 → 같은 핸들을 두 번 지워도 한 번만 성공
+ *  - Create():  빈 슬롯을 꺼내서 generation + 1과 포인터를 한 번에 기록
+ *
+ *  빈 슬롯 목록은 인덱스 스택(Treiber stack)이고, head에 32비트 태그를 붙여
+ *  꺼낼 때마다 태그를 올리므로 ABA(꺼냄→다시 넣음 사이의 CAS 오판)가 생기지 않습니다.
+ *
+ *  generation 0은 발급되지 않으므로 0으로 초기화한 SlotHandle은 항상 무효입니다.
+ *  generation이 kMaxGeneration에 이른 슬롯은 Destroy 때 은퇴시키고 다시 발급하지 않습니다.
+ *  16비트가 한 바퀴 돌아 1부터 다시 쓰면 65535번 전의 오래된 핸들이 다시 유효해지기 때문입니다.
+ *  (슬롯 하나를 65535번 재사용할 때마다 용량이 하나씩 줄어듦)
+ *  Resolve()가 돌려준 포인터의 수명(지연 삭제 등)은 호출 측이 관리합니다.
+ *============================================================================*/
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+struct SlotHandle {
+    uint32_t index = 0;
+    uint32_t generation = 0;   // 0 = 발급되지 않은 핸들 (항상 무효)
+};
+
+class ConcurrentSlotMap {
+public:
+    static constexpr uint32_t kMaxGeneration = 0xFFFF;   // 여기까지 쓴 슬롯은 은퇴 (한 바퀴 돌지 않음)
+
+    // 슬롯 capacity개를 미리 확보 (이후 크기는 바뀌지 않음)
+    explicit ConcurrentSlotMap(uint32_t capacity);
+
+    ConcurrentSlotMap(const ConcurrentSlotMap&) = delete;
+    ConcurrentSlotMap& operator=(const ConcurrentSlotMap&) = delete;
+
+    // ptr(nullptr 불가)를 등록. 빈 슬롯이 없으면 generation 0 핸들(무효)
+    SlotHandle Create(void* ptr);
+
+    // 살아 있는 핸들이면 제거하고 true. 이미 지워졌거나 오래된 핸들이면 false
+    // (generation이 kMaxGeneration인 슬롯은 빈 슬롯 목록에 돌려놓지 않음)
+    bool Destroy(const SlotHandle& handle);
+
+    // 살아 있으면 포인터, 아니면 nullptr (어느 스레드에서든 호출 가능)
+    void* Resolve(const SlotHandle& handle) const {
+        if (handle.index >= m_Capacity) return nullptr;
+        uint64_t word = m_Slots[handle.index].load(std::memory_order_acquire);
+        if ((word >> kPointerBits) != handle.generation) return nullptr;
+        return reinterpret_cast<void*>(static_cast<uintptr_t>(word & kPointerMask));
+    }
+
+    bool IsHandleValid(const SlotHandle& handle) const { return Resolve(handle) != nullptr; }
+
+    uint32_t Capacity() const { return m_Capacity; }
+
+private:
+    static constexpr int      kPointerBits = 48;
+    static constexpr uint64_t kPointerMask = (1ull << kPointerBits) - 1;
+    static constexpr uint32_t kEndOfList   = 0xFFFFFFFFu;
+
+    bool PopFree(uint32_t& index);
+    void PushFree(uint32_t index);
+
+    std::unique_ptr<std::atomic<uint64_t>[]> m_Slots;   // generation | 포인터
+    std::unique_ptr<std::atomic<uint32_t>[]> m_Next;    // 빈 슬롯 목록의 다음 인덱스
+    alignas(64) std::atomic<uint64_t> m_FreeHead;       // 태그(32) | 인덱스(32)
+    uint32_t m_Capacity;
+};
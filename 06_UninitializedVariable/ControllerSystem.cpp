@@ -0,0 +1,128 @@
+/*============================================================================
+ *  ControllerSystem.cpp - 64개 묶음 단위 일괄 갱신
+ *============================================================================*/
+#include "ControllerSystem.h"
+
+#include <cstring>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace {
+
+// 켜진 비트 중 가장 낮은 위치 (v != 0)
+inline int CountTrailingZeros(uint64_t v) {
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward64(&index, v);
+    return (int)index;
+#else
+    return __builtin_ctzll(v);
+#endif
+}
+
+} // namespace
+
+size_t ControllerSystem::Add(float moveSpeed, int hp) {
+    size_t index = Size();
+    m_MoveSpeed.push_back(moveSpeed);
+    m_Position.push_back(0.0f);
+    m_Height.push_back(0.0f);
+    m_VelocityY.push_back(0.0f);
+    m_Hp.push_back(hp);
+
+    // 새 비트는 0 (입력 없음, 점프 중 아님)
+    for (ControllerBitset& bits : m_Input) bits.Resize(index + 1);
+    m_Jumping.Resize(index + 1);
+    return index;
+}
+
+void ControllerSystem::SetInput(size_t i, const InputState& input) {
+    for (size_t a = 0; a < (size_t)InputAction::Count; a++) {
+        m_Input[a].Set(i, input.Test((InputAction)a));
+    }
+}
+
+void ControllerSystem::SetInputs(const InputState* inputs) {
+    static_assert(sizeof(InputState) == 1, "InputState must stay one byte");
+    const size_t actionCount = (size_t)InputAction::Count;
+    size_t count = Size();
+    for (size_t w = 0; w < m_Jumping.WordCount(); w++) {
+        size_t base = w * 64;
+        size_t lanes = (count - base < 64) ? count - base : 64;
+
+        uint64_t words[actionCount] = {};
+        size_t k = 0;
+        // 컨트롤러 8개(8바이트)를 한 번에: 각 바이트의 a번 비트를 모아 8비트로 만듦
+        for (; k + 8 <= lanes; k += 8) {
+            uint64_t bytes;
+            memcpy(&bytes, &inputs[base + k], sizeof(bytes));
+            for (size_t a = 0; a < actionCount; a++) {
+                uint64_t lowBits = (bytes >> a) & 0x0101010101010101ull;
+                words[a] |= ((lowBits * 0x0102040810204080ull) >> 56) << k;
+            }
+        }
+        for (; k < lanes; k++) {
+            uint64_t bits = inputs[base + k].Bits();
+            for (size_t a = 0; a < actionCount; a++) {
+                words[a] |= ((bits >> a) & 1) << k;
+            }
+        }
+        for (size_t a = 0; a < actionCount; a++) m_Input[a].Word(w) = words[a];
+    }
+}
+
+InputState ControllerSystem::GetInput(size_t i) const {
+    InputState input;
+    for (size_t a = 0; a < (size_t)InputAction::Count; a++) {
+        input.Set((InputAction)a, m_Input[a].Test(i));
+    }
+    return input;
+}
+
+void ControllerSystem::Update(float dt) {
+    const ControllerBitset& forward  = m_Input[(size_t)InputAction::MoveForward];
+    const ControllerBitset& backward = m_Input[(size_t)InputAction::MoveBackward];
+    const ControllerBitset& run      = m_Input[(size_t)InputAction::Run];
+    const ControllerBitset& jump     = m_Input[(size_t)InputAction::Jump];
+
+    size_t count = Size();
+    for (size_t w = 0; w < m_Jumping.WordCount(); w++) {
+        size_t base = w * 64;
+        size_t lanes = (count - base < 64) ? count - base : 64;
+
+        // 1) 이동: 이 묶음에서 앞/뒤 입력이 하나도 없으면 건너뜀
+        uint64_t fwd = forward.Word(w), back = backward.Word(w);
+        if (fwd | back) {
+            uint64_t runBits = run.Word(w);
+            float* position = &m_Position[base];
+            const float* speed = &m_MoveSpeed[base];
+            for (size_t k = 0; k < lanes; k++) {
+                float dir = (float)((fwd >> k) & 1) - (float)((back >> k) & 1);
+                float mult = 1.0f + (float)((runBits >> k) & 1) * (kRunMultiplier - 1.0f);
+                position[k] += dir * speed[k] * mult * dt;
+            }
+        }
+
+        // 2) 점프: 새로 시작하는 컨트롤러 = 점프 입력 & 지면 위
+        uint64_t jumping = m_Jumping.Word(w);
+        uint64_t starting = jump.Word(w) & ~jumping;
+        uint64_t active = jumping | starting;
+        uint64_t landed = 0;
+        for (uint64_t bits = active; bits; bits &= bits - 1) {
+            size_t i = base + (size_t)CountTrailingZeros(bits);
+            uint64_t mask = bits & (0 - bits);
+            if (starting & mask) m_VelocityY[i] = kJumpSpeed;
+
+            m_VelocityY[i] -= kGravity * dt;
+            m_Height[i] += m_VelocityY[i] * dt;
+            if (m_Height[i] <= 0.0f) {
+                m_Height[i] = 0.0f;
+                m_VelocityY[i] = 0.0f;
+                landed |= mask;
+            }
+        }
+        m_Jumping.Word(w) = active & ~landed;
+    }
+}
@@ -0,0 +1,109 @@
+/*============================================================================
+ *  ControllerSystem - 비트 묶음 입력 상태와 SoA 일괄 PlayerController 갱신
+ *  ---------------------------------------------------------------------------
+ *  PlayerController(BUG B)는 bool 4개가 초기화되지 않고, 객체마다 Update()에서
+ *  각자 분기합니다. 여기서는
+ *
+ *  - InputState: 입력 4개를 1바이트 비트로 묶고 생성 시 0으로 초기화
+ *  - ControllerSystem: 입력 종류마다 "컨트롤러 64개 = uint64_t 1개" 비트 평면을 두고
+ *    이동/점프 값은 float 배열(SoA)로 저장
+ *
+ *  Update()는 64개 묶음 단위로 비트 마스크를 먼저 검사해서
+ *  아무도 움직이지 않거나 점프하지 않는 묶음은 통째로 건너뛰고,
+ *  이동 방향/달리기 배율은 비트를 숫자로 바꿔 분기 없이 계산합니다.
+ *
+ *      dir  = forward비트 - backward비트         (-1, 0, 1)
+ *      mult = 1 + run비트 * (kRunMultiplier - 1)
+ *      position += dir * moveSpeed * mult * dt
+ *
+ *  모든 배열은 std::vector로 값 초기화되므로 가비지 상태가 존재하지 않습니다.
+ *============================================================================*/
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+enum class InputAction : uint8_t {
+    MoveForward,
+    MoveBackward,
+    Run,
+    Jump,
+    Count,
+};
+
+// 입력 4개를 비트로 묶은 상태 (기본값: 아무것도 안 누름)
+class InputState {
+public:
+    InputState() = default;
+
+    void Set(InputAction action, bool pressed) {
+        uint8_t bit = Bit(action);
+        m_Bits = pressed ? (uint8_t)(m_Bits | bit) : (uint8_t)(m_Bits & ~bit);
+    }
+
+    bool Test(InputAction action) const { return (m_Bits & Bit(action)) != 0; }
+    void Clear() { m_Bits = 0; }
+    uint8_t Bits() const { return m_Bits; }
+
+private:
+    static uint8_t Bit(InputAction action) { return (uint8_t)(1u << (unsigned)action); }
+
+    uint8_t m_Bits = 0;
+};
+
+// 컨트롤러 수만큼의 비트 배열 (64개씩 uint64_t 하나)
+class ControllerBitset {
+public:
+    void Resize(size_t count) { m_Words.resize((count + 63) / 64, 0); }
+
+    void Set(size_t i, bool value) {
+        uint64_t mask = 1ull << (i & 63);
+        uint64_t& word = m_Words[i >> 6];
+        word = value ? (word | mask) : (word & ~mask);
+    }
+
+    bool Test(size_t i) const { return (m_Words[i >> 6] >> (i & 63)) & 1; }
+
+    size_t WordCount() const { return m_Words.size(); }
+    uint64_t Word(size_t w) const { return m_Words[w]; }
+    uint64_t& Word(size_t w) { return m_Words[w]; }
+    void ClearAll() { for (uint64_t& w : m_Words) w = 0; }
+
+private:
+    std::vector<uint64_t> m_Words;
+};
+
+class ControllerSystem {
+public:
+    static constexpr float kRunMultiplier = 1.5f;
+    static constexpr float kJumpSpeed     = 6.0f;
+    static constexpr float kGravity       = 20.0f;
+
+    size_t Add(float moveSpeed = 5.0f, int hp = 100);
+    size_t Size() const { return m_MoveSpeed.size(); }
+
+    void SetInput(size_t i, const InputState& input);
+
+    // inputs[0, Size())를 한 번에 반영 (64개씩 비트 평면 워드를 직접 만듦)
+    void SetInputs(const InputState* inputs);
+    InputState GetInput(size_t i) const;
+
+    // 이동(앞/뒤, 달리기)과 점프(시작, 중력, 착지)를 한 번에 처리
+    void Update(float dt);
+
+    float GetPosition(size_t i) const { return m_Position[i]; }
+    float GetHeight(size_t i) const { return m_Height[i]; }
+    bool  IsJumping(size_t i) const { return m_Jumping.Test(i); }
+    int   GetHp(size_t i) const { return m_Hp[i]; }
+
+private:
+    ControllerBitset   m_Input[(size_t)InputAction::Count];
+    ControllerBitset   m_Jumping;
+
+    std::vector<float> m_MoveSpeed;
+    std::vector<float> m_Position;
+    std::vector<float> m_Height;
+    std::vector<float> m_VelocityY;
+    std::vector<int>   m_Hp;
+};
@@ -0,0 +1,138 @@
+/*============================================================================
+ *  RenderItemPool.cpp - 0 페이지 예약/반납 (VirtualAlloc / mmap)
+ *============================================================================*/
+#include "RenderItemPool.h"
+
+#include <cassert>
+#include <new>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <Windows.h>
+#else
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+size_t GetPageSize() {
+#ifdef _WIN32
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwPageSize;
+#else
+    return (size_t)sysconf(_SC_PAGESIZE);
+#endif
+}
+
+// 읽기/쓰기 가능한 0 페이지 (실제 물리 페이지는 처음 쓸 때 할당됨)
+void* ReserveZeroPages(size_t bytes) {
+#ifdef _WIN32
+    return VirtualAlloc(nullptr, bytes, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+#else
+    void* p = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    return p == MAP_FAILED ? nullptr : p;
+#endif
+}
+
+void ReleasePages(void* p, size_t bytes) {
+#ifdef _WIN32
+    (void)bytes;
+    VirtualFree(p, 0, MEM_RELEASE);
+#else
+    munmap(p, bytes);
+#endif
+}
+
+// 주소는 유지한 채 내용을 버림 → 다음 접근 시 0 페이지. 실패하면 false
+// (Windows에서 다시 commit하지 못하면 그 페이지는 접근 시 액세스 위반)
+bool ResetToZeroPages(void* p, size_t bytes) {
+#ifdef _WIN32
+    VirtualFree(p, bytes, MEM_DECOMMIT);
+    return VirtualAlloc(p, bytes, MEM_COMMIT, PAGE_READWRITE) != nullptr;
+#else
+    return madvise(p, bytes, MADV_DONTNEED) == 0;
+#endif
+}
+
+} // namespace
+
+RenderItemPool::RenderItemPool(size_t maxItems)
+    : m_Fields(), m_Memory(nullptr), m_ReservedBytes(0), m_BytesPerField(0),
+      m_PageSize(GetPageSize()), m_Capacity(maxItems), m_Count(0) {
+    assert(maxItems > 0 && maxItems < kInvalidIndex);
+
+    // 필드 배열마다 페이지 경계에서 시작하도록 페이지 크기로 올림
+    size_t fieldBytes = maxItems * sizeof(uint32_t);
+    m_BytesPerField = (fieldBytes + m_PageSize - 1) / m_PageSize * m_PageSize;
+    m_ReservedBytes = m_BytesPerField * FieldCount;
+
+    m_Memory = ReserveZeroPages(m_ReservedBytes);
+    if (!m_Memory) throw std::bad_alloc();
+
+    char* base = static_cast<char*>(m_Memory);
+    for (int f = 0; f < FieldCount; f++) {
+        m_Fields[f] = reinterpret_cast<uint32_t*>(base + m_BytesPerField * f);
+    }
+}
+
+RenderItemPool::~RenderItemPool() {
+    ReleasePages(m_Memory, m_ReservedBytes);
+}
+
+uint32_t RenderItemPool::Add() {
+    if (m_Count == m_Capacity) return kInvalidIndex;
+    // 아직 쓴 적 없거나 Remove/Clear로 되돌린 자리이므로 이미 0
+    return (uint32_t)m_Count++;
+}
+
+void RenderItemPool::Remove(uint32_t index) {
+    assert(index < m_Count);
+    size_t last = m_Count - 1;
+    for (int f = 0; f < FieldCount; f++) {
+        m_Fields[f][index] = m_Fields[f][last];
+        m_Fields[f][last] = 0;
+    }
+    m_Count--;
+}
+
+void RenderItemPool::Clear() {
+    if (m_Count == 0) return;
+    // 사용한 부분만 페이지 단위로 반납
+    size_t usedBytes = (m_Count * sizeof(uint32_t) + m_PageSize - 1) / m_PageSize * m_PageSize;
+    for (int f = 0; f < FieldCount; f++) {
+        if (!ResetToZeroPages(m_Fields[f], usedBytes)) {
+            // 생성자와 같은 실패 경로. 반납만 된 페이지에 쓰지 않도록 풀을 비우고 막아 둠
+            m_Count = 0;
+            m_Capacity = 0;
+            throw std::bad_alloc();
+        }
+    }
+    m_Count = 0;
+}
+
+void RenderItemPool::SetMesh(uint32_t index, uint32_t vertexBuffer, uint32_t indexBuffer,
+                             uint32_t indexCount) {
+    assert(index < m_Count);
+    m_Fields[VertexBuffer][index] = vertexBuffer;
+    m_Fields[IndexBuffer][index] = indexBuffer;
+    m_Fields[IndexCount][index] = indexCount;
+}
+
+void RenderItemPool::SetBones(uint32_t index, uint32_t boneOffset, uint32_t boneCount) {
+    assert(index < m_Count);
+    m_Fields[BoneOffset][index] = boneOffset;
+    m_Fields[BoneCount][index] = boneCount;
+}
+
+RenderDrawList RenderItemPool::GetDrawList() const {
+    RenderDrawList list;
+    list.count = m_Count;
+    list.vertexBuffer = m_Fields[VertexBuffer];
+    list.indexBuffer = m_Fields[IndexBuffer];
+    list.indexCount = m_Fields[IndexCount];
+    list.boneOffset = m_Fields[BoneOffset];
+    list.boneCount = m_Fields[BoneCount];
+    return list;
+}
@@ -0,0 +1,76 @@
+/*============================================================================
+ *  RenderItemPool - OS가 0으로 채워 주는 페이지 위의 RenderItem 풀 (SoA)
+ *  ---------------------------------------------------------------------------
+ *  BUG C의 RenderItem 배열은 스택에 잡혀서 모든 멤버가 가비지입니다.
+ *  std::vector<RenderItem>(n)처럼 값 초기화하면 안전하지만 n개를 memset하는 비용이 듭니다.
+ *
+ *  RenderItemPool은 VirtualAlloc(Windows) / 익명 mmap(그 외)으로 메모리를 받습니다.
+ *  OS는 새 페이지를 처음 건드릴 때 0으로 채운 페이지를 주므로(demand-zero)
+ *  따로 memset하지 않아도 새 항목의 모든 값은 0입니다.
+ *  Clear()도 memset 대신 사용한 페이지를 OS에 돌려줘서(decommit / MADV_DONTNEED)
+ *  다음 사용 시 다시 0 페이지가 되게 합니다.
+ *
+ *  항목은 필드별 배열(SoA)로 저장되어 제출 루프는 필요한 배열만 순서대로 읽습니다:
+ *
+ *      RenderDrawList list = pool.GetDrawList();
+ *      for (size_t i = 0; i < list.count; i++)
+ *          Draw(list.vertexBuffer[i], list.indexBuffer[i], list.indexCount[i], list.boneOffset[i]);
+ *
+ *  포인터 대신 32비트 ID/오프셋을 저장합니다 (0 = 없음).
+ *============================================================================*/
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// 제출 루프용 읽기 전용 뷰 (Add/Remove/Clear 후에는 다시 받아야 함)
+struct RenderDrawList {
+    size_t          count;
+    const uint32_t* vertexBuffer;   // 버텍스 버퍼 ID
+    const uint32_t* indexBuffer;    // 인덱스 버퍼 ID
+    const uint32_t* indexCount;
+    const uint32_t* boneOffset;     // 본 행렬 버퍼 안의 시작 위치
+    const uint32_t* boneCount;
+};
+
+class RenderItemPool {
+public:
+    static constexpr uint32_t kInvalidIndex = 0xFFFFFFFFu;
+
+    // maxItems개 분량의 주소 공간을 한 번에 확보 (실패 시 std::bad_alloc)
+    explicit RenderItemPool(size_t maxItems);
+    ~RenderItemPool();
+
+    RenderItemPool(const RenderItemPool&) = delete;
+    RenderItemPool& operator=(const RenderItemPool&) = delete;
+
+    // 모든 필드가 0인 새 항목. 가득 차면 kInvalidIndex
+    uint32_t Add();
+
+    // 마지막 항목을 index 자리로 옮겨서 배열을 빈틈없이 유지 (마지막 자리는 0으로 되돌림)
+    void Remove(uint32_t index);
+
+    // 모든 항목 제거. 사용한 페이지를 OS에 반납하므로 memset 없이 다시 0이 됨
+    // (다시 commit하지 못하면 std::bad_alloc. 그 뒤 Add는 항상 kInvalidIndex)
+    void Clear();
+
+    void SetMesh(uint32_t index, uint32_t vertexBuffer, uint32_t indexBuffer, uint32_t indexCount);
+    void SetBones(uint32_t index, uint32_t boneOffset, uint32_t boneCount);
+
+    RenderDrawList GetDrawList() const;
+
+    size_t Size() const { return m_Count; }
+    size_t Capacity() const { return m_Capacity; }
+    size_t ReservedBytes() const { return m_ReservedBytes; }
+
+private:
+    enum Field { VertexBuffer, IndexBuffer, IndexCount, BoneOffset, BoneCount, FieldCount };
+
+    uint32_t* m_Fields[FieldCount];
+    void*     m_Memory;
+    size_t    m_ReservedBytes;
+    size_t    m_BytesPerField;      // 페이지 크기 배수
+    size_t    m_PageSize;
+    size_t    m_Capacity;
+    size_t    m_Count;
+};
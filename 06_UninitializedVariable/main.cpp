@@ -11,6 +11,18 @@
 #include <iostream>
 #include <string>
 #include <cstring>
+#include <vector>
+#include <chrono>
+#include <random>
+#include <cmath>
+#include <thread>
+#include <atomic>
+#include <mutex>
+
+#include "BoneUploadRing.h"
+#include "ConcurrentSlotMap.h"
+#include "ControllerSystem.h"
+#include "RenderItemPool.h"
 
 // ============================================================================
 // BUG A: 미초기화 포인터 멤버
@@ -181,6 +193,555 @@ void BugD_UninitializedHandle() {
     std::cout << "  [결과] 가비지 generation이 우연히 일치하면 잘못된 객체에 접근!\n";
 }
 
+// ============================================================================
+// E: 비트 묶음 입력 + SoA 일괄 PlayerController 갱신
+// ============================================================================
+// fn을 rounds번 실행해서 가장 빠른 시간(ms)을 돌려줌. prepare는 측정에서 제외
+template <typename Prepare, typename Fn>
+double MeasureBestMs(int rounds, Prepare prepare, Fn fn) {
+    double best = 1e30;
+    for (int r = 0; r < rounds; r++) {
+        prepare();
+        auto start = std::chrono::steady_clock::now();
+        fn();
+        auto end = std::chrono::steady_clock::now();
+        double ms = std::chrono::duration<double, std::milli>(end - start).count();
+        if (ms < best) best = ms;
+    }
+    return best;
+}
+
+// 비교용: 모든 멤버를 초기화했지만 객체마다 분기하는 PlayerController
+class BranchyPlayerController {
+public:
+    bool isInputMoveForward = false;
+    bool isInputMoveBackward = false;
+    bool isInputRun = false;
+    bool isInputJump = false;
+    bool isJumping = false;
+    float moveSpeed = 5.0f;
+    int hp = 100;
+    float position = 0.0f;
+    float height = 0.0f;
+    float velocityY = 0.0f;
+
+    void Update(float dt) {
+        float mult = isInputRun ? ControllerSystem::kRunMultiplier : 1.0f;
+        if (isInputMoveForward) position += 1.0f * moveSpeed * mult * dt;
+        if (isInputMoveBackward) position += -1.0f * moveSpeed * mult * dt;
+        if (isInputJump && !isJumping) {
+            isJumping = true;
+            velocityY = ControllerSystem::kJumpSpeed;
+        }
+        if (isJumping) {
+            velocityY -= ControllerSystem::kGravity * dt;
+            height += velocityY * dt;
+            if (height <= 0.0f) {
+                height = 0.0f;
+                velocityY = 0.0f;
+                isJumping = false;
+            }
+        }
+    }
+};
+
+void BenchmarkControllerSystem() {
+    std::cout << "\n[E] 비트 묶음 입력 + SoA 일괄 PlayerController 갱신\n";
+    std::cout << "  입력은 생성 시 0으로 초기화되고, 갱신은 64개 묶음의 비트 마스크로 처리합니다.\n";
+    std::cout << "  (Debug 빌드에서는 수치가 크게 왜곡되므로 Release에서 측정하세요)\n\n";
+
+    InputState fresh;
+    std::cout << "  새 InputState 비트 = " << (int)fresh.Bits() << " (가비지 없음, "
+              << sizeof(InputState) << "바이트)\n\n";
+
+    const size_t COUNT = 100 * 1000;
+    const int FRAMES = 60;
+    const int ROUNDS = 5;
+    const float DT = 1.0f / 60.0f;
+
+    // 프레임마다 바뀌는 무작위 입력 (앞 40%, 뒤 20%, 달리기 30%, 점프 2%)
+    std::mt19937 rng(31);
+    std::vector<InputState> inputs((size_t)FRAMES * COUNT);
+    for (InputState& in : inputs) {
+        uint32_t r = rng() % 100;
+        in.Set(InputAction::MoveForward, r < 40);
+        in.Set(InputAction::MoveBackward, r >= 40 && r < 60);
+        in.Set(InputAction::Run, rng() % 100 < 30);
+        in.Set(InputAction::Jump, rng() % 100 < 2);
+    }
+
+    std::vector<BranchyPlayerController> objects;
+    double objectMs = MeasureBestMs(ROUNDS, [&] {
+        objects.assign(COUNT, BranchyPlayerController());
+    }, [&] {
+        for (int f = 0; f < FRAMES; f++) {
+            const InputState* frameInput = &inputs[(size_t)f * COUNT];
+            for (size_t i = 0; i < COUNT; i++) {
+                BranchyPlayerController& pc = objects[i];
+                pc.isInputMoveForward = frameInput[i].Test(InputAction::MoveForward);
+                pc.isInputMoveBackward = frameInput[i].Test(InputAction::MoveBackward);
+                pc.isInputRun = frameInput[i].Test(InputAction::Run);
+                pc.isInputJump = frameInput[i].Test(InputAction::Jump);
+                pc.Update(DT);
+            }
+        }
+    });
+
+    ControllerSystem system;
+    double batchMs = MeasureBestMs(ROUNDS, [&] {
+        system = ControllerSystem();
+        for (size_t i = 0; i < COUNT; i++) system.Add();
+    }, [&] {
+        for (int f = 0; f < FRAMES; f++) {
+            const InputState* frameInput = &inputs[(size_t)f * COUNT];
+            system.SetInputs(frameInput);
+            system.Update(DT);
+        }
+    });
+
+    double updateOnlyMs = MeasureBestMs(ROUNDS, [] {}, [&] {
+        for (int f = 0; f < FRAMES; f++) system.Update(DT);
+    });
+
+    // 같은 결과인지 확인 (같은 순서로 계산하므로 비트 단위로 같아야 함)
+    ControllerSystem check;
+    for (size_t i = 0; i < COUNT; i++) check.Add();
+    for (int f = 0; f < FRAMES; f++) {
+        check.SetInputs(&inputs[(size_t)f * COUNT]);
+        check.Update(DT);
+    }
+    size_t mismatches = 0, jumping = 0;
+    for (size_t i = 0; i < COUNT; i++) {
+        const BranchyPlayerController& pc = objects[i];
+        if (pc.position != check.GetPosition(i) || pc.height != check.GetHeight(i) ||
+            pc.isJumping != check.IsJumping(i)) {
+            mismatches++;
+        }
+        if (check.IsJumping(i)) jumping++;
+    }
+
+    std::cout << "  컨트롤러 " << COUNT << "개 × " << FRAMES << "프레임 (입력 설정 포함)\n";
+    std::cout << "  객체별 Update (bool 분기)  : " << objectMs / FRAMES << " ms/프레임\n";
+    std::cout << "  ControllerSystem (비트 SoA) : " << batchMs / FRAMES << " ms/프레임 ("
+              << objectMs / batchMs << "x)\n";
+    std::cout << "    그중 Update()만                : " << updateOnlyMs / FRAMES << " ms/프레임\n";
+    std::cout << "  결과 불일치 " << mismatches << "개, 마지막 프레임에 점프 중 " << jumping << "개\n";
+
+    std::cout << "\n  [결과] 초기화 누락이 구조적으로 불가능하고, 분기 예측 실패 없이 일괄 갱신됩니다.\n";
+}
+
+// ============================================================================
+// F: 0 페이지 기반 RenderItemPool + SoA 드로우 리스트
+// ============================================================================
+void BenchmarkRenderItemPool() {
+    std::cout << "\n[F] 0 페이지 기반 RenderItemPool + SoA 드로우 리스트\n";
+    std::cout << "  OS가 0으로 채운 페이지를 받아서 memset 없이 모든 항목이 0에서 시작합니다.\n";
+    std::cout << "  (Debug 빌드에서는 수치가 크게 왜곡되므로 Release에서 측정하세요)\n\n";
+
+    // 1) BUG C와 비교: 새 항목은 항상 0
+    {
+        RenderItemPool pool(16);
+        uint32_t id = pool.Add();
+        RenderDrawList list = pool.GetDrawList();
+        std::cout << "  새 항목: vertexBuffer=" << list.vertexBuffer[id]
+                  << ", indexBuffer=" << list.indexBuffer[id]
+                  << ", indexCount=" << list.indexCount[id]
+                  << ", boneOffset=" << list.boneOffset[id]
+                  << ", boneCount=" << list.boneCount[id] << " (가비지 없음)\n\n";
+    }
+
+    const size_t COUNT = 1024 * 1024;
+    const int ROUNDS = 5;
+
+    // 2) 생성: 값 초기화한 vector<RenderItem>(memset 포함) vs 풀(0 페이지)
+    std::vector<RenderItem> items;
+    double aosBuildMs = MeasureBestMs(ROUNDS, [&] { items = std::vector<RenderItem>(); }, [&] {
+        items.resize(COUNT);   // 값 초기화 → 전체 memset
+        for (size_t i = 0; i < COUNT; i++) {
+            if (i % 4 == 0) continue;   // 1/4은 아직 메시 없음 (0 그대로)
+            items[i].vertexBuffer = (void*)(uintptr_t)(i + 1);
+            items[i].indexBuffer = (void*)(uintptr_t)(i + 2);
+            items[i].indexCount = (unsigned int)(36 + i % 64);
+        }
+    });
+
+    RenderItemPool pool(COUNT);
+    double poolBuildMs = MeasureBestMs(ROUNDS, [&] { pool.Clear(); }, [&] {
+        for (size_t i = 0; i < COUNT; i++) {
+            uint32_t id = pool.Add();
+            if (i % 4 == 0) continue;
+            pool.SetMesh(id, (uint32_t)(i + 1), (uint32_t)(i + 2), (uint32_t)(36 + i % 64));
+            pool.SetBones(id, (uint32_t)(i * 4), 4);
+        }
+    });
+    std::cout << "  항목 " << COUNT << "개 생성 + 설정\n";
+    std::cout << "    vector<RenderItem> (값 초기화, " << sizeof(RenderItem) << "B/항목) : "
+              << aosBuildMs << " ms\n";
+    std::cout << "    RenderItemPool     (0 페이지, " << 5 * sizeof(uint32_t) << "B/항목)  : "
+              << poolBuildMs << " ms\n\n";
+
+    // 3) 제출 루프: AoS 구조체 순회 vs 필요한 SoA 배열만 순회
+    uint64_t aosIndices = 0, aosDraws = 0;
+    double aosSubmitMs = MeasureBestMs(ROUNDS, [&] { aosIndices = aosDraws = 0; }, [&] {
+        for (const RenderItem& item : items) {
+            aosDraws += item.indexCount != 0;
+            aosIndices += item.indexCount + ((uintptr_t)item.vertexBuffer & 1);
+        }
+    });
+
+    uint64_t soaIndices = 0, soaDraws = 0;
+    double soaSubmitMs = MeasureBestMs(ROUNDS, [&] { soaIndices = soaDraws = 0; }, [&] {
+        RenderDrawList list = pool.GetDrawList();
+        for (size_t i = 0; i < list.count; i++) {
+            soaDraws += list.indexCount[i] != 0;
+            soaIndices += list.indexCount[i] + (list.vertexBuffer[i] & 1);
+        }
+    });
+    std::cout << "  제출 루프 (드로우 " << soaDraws << "개)\n";
+    std::cout << "    AoS RenderItem 순회 : " << aosSubmitMs << " ms\n";
+    std::cout << "    SoA 드로우 리스트   : " << soaSubmitMs << " ms (" << aosSubmitMs / soaSubmitMs
+              << "x), 결과 " << (aosIndices == soaIndices && aosDraws == soaDraws ? "동일" : "다름!")
+              << "\n\n";
+
+    // 4) 재사용: Clear는 memset 대신 페이지 반납
+    double clearMs = MeasureBestMs(1, [] {}, [&] { pool.Clear(); });
+    size_t nonZero = 0;
+    for (size_t i = 0; i < COUNT; i++) {
+        uint32_t id = pool.Add();
+        RenderDrawList list = pool.GetDrawList();
+        nonZero += (list.vertexBuffer[id] | list.indexBuffer[id] | list.indexCount[id] |
+                    list.boneOffset[id] | list.boneCount[id]) != 0;
+    }
+    std::cout << "  Clear() " << clearMs << " ms 후 다시 " << COUNT << "개 Add → 0이 아닌 항목 "
+              << nonZero << "개\n";
+
+    std::cout << "\n  [결과] 초기화를 잊을 수 없고, 제출 루프는 필요한 필드만 연속으로 읽습니다.\n";
+}
+
+// ============================================================================
+// G: lock-free ConcurrentSlotMap (16스레드 스트레스/벤치마크)
+// ============================================================================
+// 비교용: 모든 값을 초기화한 Slot 배열 + mutex
+class LockedSlotMap {
+public:
+    explicit LockedSlotMap(uint32_t capacity) : m_Slots(capacity) {
+        for (uint32_t i = capacity; i > 0; i--) m_Free.push_back(i - 1);
+    }
+
+    SlotHandle Create(void* ptr) {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        SlotHandle handle;
+        if (m_Free.empty()) return handle;
+        handle.index = m_Free.back();
+        m_Free.pop_back();
+        LockedSlot& slot = m_Slots[handle.index];
+        slot.generation++;
+        slot.ptr = ptr;
+        handle.generation = slot.generation;
+        return handle;
+    }
+
+    bool Destroy(const SlotHandle& handle) {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        if (handle.index >= m_Slots.size()) return false;
+        LockedSlot& slot = m_Slots[handle.index];
+        if (slot.generation != handle.generation || slot.ptr == nullptr) return false;
+        slot.ptr = nullptr;
+        // ConcurrentSlotMap과 같이 generation을 다 쓴 슬롯은 은퇴
+        if (slot.generation < ConcurrentSlotMap::kMaxGeneration) m_Free.push_back(handle.index);
+        return true;
+    }
+
+    void* Resolve(const SlotHandle& handle) const {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        if (handle.index >= m_Slots.size()) return nullptr;
+        const LockedSlot& slot = m_Slots[handle.index];
+        return slot.generation == handle.generation ? slot.ptr : nullptr;
+    }
+
+private:
+    struct LockedSlot {
+        void* ptr = nullptr;
+        uint32_t generation = 0;
+    };
+
+    mutable std::mutex m_Mutex;
+    std::vector<LockedSlot> m_Slots;
+    std::vector<uint32_t> m_Free;
+};
+
+inline uint64_t PackHandle(const SlotHandle& h) { return ((uint64_t)h.index << 32) | h.generation; }
+
+inline SlotHandle UnpackHandle(uint64_t packed) {
+    SlotHandle h;
+    h.index = (uint32_t)(packed >> 32);
+    h.generation = (uint32_t)packed;
+    return h;
+}
+
+struct SlotMapRunResult {
+    double ms = 0.0;
+    uint64_t resolves = 0;
+    uint64_t hits = 0;
+    uint64_t churns = 0;
+    uint64_t errors = 0;
+};
+
+// 스레드마다 자기 핸들 LIVE개를 만들고/지우면서(1/16), 나머지는 모든 스레드가
+// 공개한 핸들을 무작위로 해석. 자기 핸들로 다음을 검사합니다:
+//   - 만든 직후 Resolve == 등록한 포인터 (슬롯이 두 스레드에 중복 발급되면 깨짐)
+//   - 지운 직후 Resolve == nullptr, 두 번째 Destroy == false
+template <typename Map>
+SlotMapRunResult RunSlotMapThreads(Map& map, int threadCount, int live, int opsPerThread) {
+    const size_t total = (size_t)threadCount * live;
+    std::vector<int> objects(total);
+    std::vector<std::atomic<uint64_t>> published(total);
+    for (auto& p : published) p.store(0, std::memory_order_relaxed);
+
+    std::atomic<int> ready(0);
+    std::atomic<bool> go(false);
+    std::atomic<uint64_t> hits(0), churns(0), errors(0);
+
+    auto worker = [&](int t) {
+        uint32_t rng = 0x9E3779B9u * (uint32_t)(t + 1);
+        auto next = [&rng] {
+            rng ^= rng << 13; rng ^= rng >> 17; rng ^= rng << 5;
+            return rng;
+        };
+        int* const myObjects = &objects[(size_t)t * live];
+        std::vector<SlotHandle> mine(live);
+        uint64_t localHits = 0, localChurns = 0, localErrors = 0;
+
+        auto createOwn = [&](int k) {
+            mine[k] = map.Create(&myObjects[k]);
+            if (mine[k].generation == 0 || map.Resolve(mine[k]) != &myObjects[k]) localErrors++;
+            published[(size_t)t * live + k].store(PackHandle(mine[k]), std::memory_order_relaxed);
+        };
+        for (int k = 0; k < live; k++) createOwn(k);
+
+        ready.fetch_add(1);
+        while (!go.load(std::memory_order_acquire)) std::this_thread::yield();
+
+        const int* const first = objects.data();
+        const int* const last = first + total;
+        for (int op = 0; op < opsPerThread; op++) {
+            uint32_t r = next();
+            if ((r & 15) == 0) {
+                int k = (int)((r >> 4) % (uint32_t)live);
+                SlotHandle old = mine[k];
+                if (!map.Destroy(old) || map.Resolve(old) != nullptr || map.Destroy(old)) localErrors++;
+                createOwn(k);
+                localChurns++;
+            } else {
+                SlotHandle h = UnpackHandle(published[(r >> 4) % total].load(std::memory_order_relaxed));
+                const int* p = static_cast<const int*>(map.Resolve(h));
+                if (p) {
+                    if (p < first || p >= last) localErrors++;
+                    localHits++;
+                }
+            }
+        }
+        hits += localHits;
+        churns += localChurns;
+        errors += localErrors;
+    };
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadCount; t++) threads.emplace_back(worker, t);
+    while (ready.load() < threadCount) std::this_thread::yield();
+
+    auto start = std::chrono::steady_clock::now();
+    go.store(true, std::memory_order_release);
+    for (auto& th : threads) th.join();
+    auto end = std::chrono::steady_clock::now();
+
+    SlotMapRunResult result;
+    result.ms = std::chrono::duration<double, std::milli>(end - start).count();
+    result.churns = churns.load();
+    result.resolves = (uint64_t)threadCount * opsPerThread - result.churns;
+    result.hits = hits.load();
+    result.errors = errors.load();
+    return result;
+}
+
+void BenchmarkConcurrentSlotMap() {
+    std::cout << "\n[G] lock-free ConcurrentSlotMap (16스레드 스트레스/벤치마크)\n";
+    std::cout << "  generation과 포인터를 원자 워드 하나에 묶어 wait-free로 핸들을 해석합니다.\n";
+    std::cout << "  (Debug 빌드에서는 수치가 크게 왜곡되므로 Release에서 측정하세요)\n\n";
+
+    // 1) BUG D와 비교: 0으로 초기화된 핸들은 항상 무효, 지운 핸들도 무효
+    {
+        ConcurrentSlotMap map(4);
+        int object = 42;
+        SlotHandle empty;
+        SlotHandle handle = map.Create(&object);
+        std::cout << "  기본 SlotHandle{" << empty.index << ", " << empty.generation
+                  << "} 유효? " << map.IsHandleValid(empty) << "\n";
+        std::cout << "  Create → {" << handle.index << ", " << handle.generation
+                  << "} 유효? " << map.IsHandleValid(handle) << "\n";
+        map.Destroy(handle);
+        SlotHandle reused = map.Create(&object);
+        std::cout << "  Destroy 후 같은 슬롯 재사용 → {" << reused.index << ", " << reused.generation
+                  << "}, 옛 핸들 유효? " << map.IsHandleValid(handle) << "\n";
+    }
+
+    // 2) 슬롯 하나를 generation이 다 찰 때까지 재사용 → 은퇴, 첫 핸들은 끝까지 무효
+    {
+        ConcurrentSlotMap map(1);
+        int object = 7;
+        SlotHandle first = map.Create(&object);
+        SlotHandle last = first;
+        uint32_t issued = 1;
+        for (;;) {
+            map.Destroy(last);
+            SlotHandle next = map.Create(&object);
+            if (next.generation == 0) break;
+            last = next;
+            issued++;
+        }
+        std::cout << "  슬롯 1개로 핸들 " << issued << "개 발급 (마지막 generation " << last.generation
+                  << ") 후 은퇴, 첫 핸들 유효? " << map.IsHandleValid(first) << "\n\n";
+    }
+
+    const int THREADS = 16;
+    const int LIVE = 32;            // 스레드당 살아 있는 핸들 수 (슬롯 수 = 16 * 32)
+    const int OPS = 200000;         // 스레드당 연산 수 (1/16은 Destroy + Create)
+    const int ROUNDS = 3;
+
+    SlotMapRunResult lockedBest, lockFreeBest;
+    lockedBest.ms = lockFreeBest.ms = 1e30;
+    uint64_t lockedErrors = 0, lockFreeErrors = 0;
+    for (int r = 0; r < ROUNDS; r++) {
+        LockedSlotMap locked(THREADS * LIVE);
+        SlotMapRunResult a = RunSlotMapThreads(locked, THREADS, LIVE, OPS);
+        lockedErrors += a.errors;
+        if (a.ms < lockedBest.ms) lockedBest = a;
+
+        ConcurrentSlotMap lockFree(THREADS * LIVE);
+        SlotMapRunResult b = RunSlotMapThreads(lockFree, THREADS, LIVE, OPS);
+        lockFreeErrors += b.errors;
+        if (b.ms < lockFreeBest.ms) lockFreeBest = b;
+    }
+
+    auto print = [](const char* name, const SlotMapRunResult& r, uint64_t errors) {
+        double mops = (double)(r.resolves + r.churns) / (r.ms * 1000.0);
+        std::cout << "    " << name << r.ms << " ms (" << mops << " M ops/s), 해석 성공 "
+                  << r.hits << "/" << r.resolves << ", 생성/삭제 " << r.churns
+                  << ", 오류 " << errors << "\n";
+    };
+    std::cout << "  스레드 " << THREADS << "개 x 연산 " << OPS << "개, 하드웨어 스레드 "
+              << std::thread::hardware_concurrency() << "개\n";
+    print("mutex + Slot 배열     : ", lockedBest, lockedErrors);
+    print("ConcurrentSlotMap     : ", lockFreeBest, lockFreeErrors);
+    std::cout << "    → " << lockedBest.ms / lockFreeBest.ms << "x\n";
+
+    std::cout << "\n  [결과] " << (lockFreeErrors == 0 ? "중복 발급/오래된 핸들 해석 없음. " : "오류 발생! ")
+              << "해석은 잠금 없이 원자 로드 한 번입니다.\n";
+}
+
+// ============================================================================
+// H: 프레임 링(3중 버퍼) 본 행렬 업로드 버퍼
+// ============================================================================
+void BenchmarkBoneUploadRing() {
+    std::cout << "\n[H] 프레임 링(3중 버퍼) 본 행렬 업로드 버퍼\n";
+    std::cout << "  캐릭터별 new float[] 대신 프레임 영역에서 잘라 쓰고 오프셋 핸들을 받습니다.\n";
+    std::cout << "  (Debug 빌드에서는 수치가 크게 왜곡되므로 Release에서 측정하세요)\n\n";
+
+    const uint32_t CHARACTERS = 2000;
+    const int FRAMES = 20;
+    const int ROUNDS = 3;
+    const size_t FPM = BoneUploadRing::kFloatsPerMatrix;
+
+    // 캐릭터마다 본 32~95개, 애니메이션 결과(원본 팔레트)는 미리 계산해 둠
+    std::vector<uint32_t> boneCounts(CHARACTERS);
+    std::vector<size_t> sourceOffsets(CHARACTERS);
+    size_t totalMatrices = 0;
+    for (uint32_t c = 0; c < CHARACTERS; c++) {
+        boneCounts[c] = 32 + c % 64;
+        sourceOffsets[c] = totalMatrices * FPM;
+        totalMatrices += boneCounts[c];
+    }
+    std::vector<float> sources(totalMatrices * FPM);
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+    for (float& f : sources) f = dist(rng);
+
+    // 1) 오프셋 핸들 → RenderItemPool::SetBones
+    {
+        BoneUploadRing ring(256);
+        RenderItemPool pool(4);
+        std::cout << "  프레임 영역 시작 오프셋:";
+        for (int f = 0; f < 4; f++) {
+            ring.BeginFrame();
+            BonePaletteHandle h = ring.Allocate(64);
+            uint32_t id = pool.Add();
+            pool.SetBones(id, h.offset, h.count);
+            std::cout << " " << pool.GetDrawList().boneOffset[id];
+        }
+        BonePaletteHandle tooBig = ring.Allocate(1000);
+        std::cout << " (3프레임 주기), 공간 부족 시 count=" << tooBig.count << "\n\n";
+    }
+
+    // 2) 기존 방식: 캐릭터마다 new float[] + 업로드 전에 한 버퍼로 모으기 + delete
+    std::vector<RenderItem> items(CHARACTERS);
+    std::vector<float> staging(totalMatrices * FPM);
+    double mallocMs = MeasureBestMs(ROUNDS, [] {}, [&] {
+        for (int f = 0; f < FRAMES; f++) {
+            for (uint32_t c = 0; c < CHARACTERS; c++) {
+                size_t floats = boneCounts[c] * FPM;
+                items[c].boneCount = boneCounts[c];
+                items[c].boneMatrices = new float[floats];
+                memcpy(items[c].boneMatrices, &sources[sourceOffsets[c]], floats * sizeof(float));
+            }
+            size_t cursor = 0;
+            for (uint32_t c = 0; c < CHARACTERS; c++) {
+                size_t floats = items[c].boneCount * FPM;
+                memcpy(&staging[cursor], items[c].boneMatrices, floats * sizeof(float));
+                cursor += floats;
+                delete[] items[c].boneMatrices;
+                items[c].boneMatrices = nullptr;
+            }
+        }
+    });
+
+    // 3) 링 버퍼 + 일반 저장 / 스트리밍 저장
+    BoneUploadRing ring((uint32_t)totalMatrices);
+    double ringCopyMs = MeasureBestMs(ROUNDS, [] {}, [&] {
+        for (int f = 0; f < FRAMES; f++) {
+            ring.BeginFrame();
+            for (uint32_t c = 0; c < CHARACTERS; c++) {
+                BonePaletteHandle h = ring.Allocate(boneCounts[c]);
+                memcpy(ring.GetPalette(h), &sources[sourceOffsets[c]], h.count * FPM * sizeof(float));
+            }
+            ring.EndFrame();
+        }
+    });
+    double ringStreamMs = MeasureBestMs(ROUNDS, [] {}, [&] {
+        for (int f = 0; f < FRAMES; f++) {
+            ring.BeginFrame();
+            for (uint32_t c = 0; c < CHARACTERS; c++) {
+                BonePaletteHandle h = ring.Allocate(boneCounts[c]);
+                ring.WritePalette(h, &sources[sourceOffsets[c]]);
+            }
+            ring.EndFrame();
+        }
+    });
+
+    bool same = ring.GetUsedMatrices() == totalMatrices &&
+                memcmp(ring.GetFrameData(), staging.data(), staging.size() * sizeof(float)) == 0;
+
+    std::cout << "  캐릭터 " << CHARACTERS << "명, 행렬 " << totalMatrices << "개 ("
+              << totalMatrices * FPM * sizeof(float) / (1024 * 1024) << " MB)/프레임 x " << FRAMES
+              << "프레임\n";
+    std::cout << "    new float[] + 모으기 + delete : " << mallocMs << " ms\n";
+    std::cout << "    링 버퍼 + memcpy               : " << ringCopyMs << " ms ("
+              << mallocMs / ringCopyMs << "x)\n";
+    std::cout << "    링 버퍼 + 스트리밍 저장        : " << ringStreamMs << " ms ("
+              << mallocMs / ringStreamMs << "x), 업로드 내용 " << (same ? "동일" : "다름!") << "\n";
+
+    std::cout << "\n  [결과] 프레임당 malloc 0회, 팔레트는 한 버퍼에 연속으로 놓여 모으기 복사가 없습니다.\n";
+}
+
 // ============================================================================
 // 메인
 // ============================================================================
@@ -195,6 +756,10 @@ int main() {
     std::cout << "  [B] 미초기화 bool/숫자 멤버 (오동작)\n";
     std::cout << "  [C] 미초기화 구조체 배열 (가비지 렌더링)\n";
     std::cout << "  [D] Handle/Slot 미초기화 (유효성 검사 오동작)\n";
+    std::cout << "  [E] 비트 묶음 입력 + SoA 일괄 PlayerController 갱신\n";
+    std::cout << "  [F] 0 페이지 기반 RenderItemPool + SoA 드로우 리스트\n";
+    std::cout << "  [G] lock-free ConcurrentSlotMap (16스레드 스트레스/벤치마크)\n";
+    std::cout << "  [H] 프레임 링(3중 버퍼) 본 행렬 업로드 버퍼\n";
     std::cout << "  [Q] 종료\n";
     std::cout << "----------------------------------------------------\n";
 
@@ -209,6 +774,10 @@ int main() {
         case 'B': BugB_UninitializedBoolAndNumbers(); break;
         case 'C': BugC_UninitializedStruct(); break;
         case 'D': BugD_UninitializedHandle(); break;
+        case 'E': BenchmarkControllerSystem(); break;
+        case 'F': BenchmarkRenderItemPool(); break;
+        case 'G': BenchmarkConcurrentSlotMap(); break;
+        case 'H': BenchmarkBoneUploadRing(); break;
         case 'Q': std::cout << "종료합니다.\n"; return 0;
         default:  std::cout << "잘못된 입력입니다.\n"; break;
         }
@@ -0,0 +1,50 @@
+/*============================================================================
+ *  CheckedSpan.cpp - 범위 위반 보고 (느린 경로)
+ *============================================================================*/
+#include "CheckedSpan.h"
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace {
+
+std::atomic<size_t> s_ViolationCount(0);
+
+[[noreturn]] void Trap() {
+#if defined(_MSC_VER)
+    __debugbreak();
+#endif
+    std::abort();
+}
+
+} // namespace
+
+namespace CheckedSpanDetail {
+
+void ReportViolation(const char* operation, size_t index, size_t count, size_t size, bool recoverable) {
+    s_ViolationCount.fetch_add(1, std::memory_order_relaxed);
+    fprintf(stderr, "  [CheckedSpan] %s 범위 위반: index/offset=%zu, count=%zu, size=%zu\n",
+            operation, index, count, size);
+    fflush(stderr);
+
+    if (CHECKED_SPAN_POLICY == CHECKED_SPAN_POLICY_TRAP || !recoverable) Trap();
+}
+
+} // namespace CheckedSpanDetail
+
+const char* GetCheckedSpanPolicyName() {
+    switch (CHECKED_SPAN_POLICY) {
+    case CHECKED_SPAN_POLICY_OFF:  return "OFF";
+    case CHECKED_SPAN_POLICY_TRAP: return "TRAP";
+    default:                       return "LOG";
+    }
+}
+
+size_t GetBoundsViolationCount() {
+    return s_ViolationCount.load(std::memory_order_relaxed);
+}
@@ -0,0 +1,160 @@
+/*============================================================================
+ *  CheckedSpan - 루프 진입 시 한 번만 범위를 검사하는 span
+ *  ---------------------------------------------------------------------------
+ *  BUG A(빈 벡터의 [0])와 BUG B(> 대신 >=)는 operator[]가 아무것도 검사하지 않아서
+ *  생깁니다. 그렇다고 .at()을 모든 루프에 쓰면 원소마다 비교 + 예외 경로가 생겨
+ *  벡터화가 막히고 느려집니다.
+ *
+ *  CheckedSpan<T>는 (포인터, 크기)만 들고 다니며
+ *  - Subspan/First/Last: 잘라낼 범위를 한 번 검사 → 결과 span은 항상 유효
+ *  - begin()/end(): 원시 포인터. range-for 안쪽 루프는 T* 루프와 똑같이 컴파일됨
+ *  - Zip(a, b): 두 span의 크기를 루프 전에 한 번 비교하고 나란히 순회
+ *  - operator[]: 원소 하나 접근은 매번 검사 (루프 밖 임의 접근용)
+ *  - Unchecked(i): 이미 검사한 인덱스용
+ *
+ *  범위를 벗어나면 빌드별 정책(CHECKED_SPAN_POLICY)에 따라
+ *      OFF  : 검사 코드 자체를 빼고 컴파일 (출시 빌드의 핫 루프용)
+ *      LOG  : stderr에 보고하고 안전한 값으로 계속 (잘라낸 범위는 빈 span,
+ *             operator[]는 마지막 원소). 빈 span의 operator[]처럼 돌려줄 값이 없으면 중단
+ *      TRAP : 보고 후 즉시 중단 (디버거에서 멈춤)
+ *  기본값은 LOG이며, 프로젝트 전처리기 정의로 바꿉니다 (예: CHECKED_SPAN_POLICY=2).
+ *============================================================================*/
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+#define CHECKED_SPAN_POLICY_OFF  0
+#define CHECKED_SPAN_POLICY_LOG  1
+#define CHECKED_SPAN_POLICY_TRAP 2
+
+#ifndef CHECKED_SPAN_POLICY
+#define CHECKED_SPAN_POLICY CHECKED_SPAN_POLICY_LOG
+#endif
+
+namespace CheckedSpanDetail {
+
+// 범위 위반 보고 (느린 경로라 인라인하지 않음). TRAP이거나 recoverable이 false면 돌아오지 않음
+void ReportViolation(const char* operation, size_t index, size_t count, size_t size, bool recoverable);
+
+} // namespace CheckedSpanDetail
+
+const char* GetCheckedSpanPolicyName();
+
+// 지금까지 보고된 범위 위반 수
+size_t GetBoundsViolationCount();
+
+template <typename T>
+class CheckedSpan {
+public:
+    CheckedSpan() = default;
+    CheckedSpan(T* data, size_t size) : m_Data(data), m_Size(size) {}
+
+    template <size_t N>
+    CheckedSpan(T (&array)[N]) : m_Data(array), m_Size(N) {}
+
+    template <typename U, typename Alloc,
+              typename = std::enable_if_t<std::is_same_v<std::remove_const_t<T>, U>>>
+    CheckedSpan(std::vector<U, Alloc>& v) : m_Data(v.data()), m_Size(v.size()) {}
+
+    template <typename U, typename Alloc,
+              typename = std::enable_if_t<std::is_const_v<T> && std::is_same_v<std::remove_const_t<T>, U>>>
+    CheckedSpan(const std::vector<U, Alloc>& v) : m_Data(v.data()), m_Size(v.size()) {}
+
+    // CheckedSpan<T> → CheckedSpan<const T>
+    template <typename U, typename = std::enable_if_t<std::is_same_v<const U, T> && !std::is_same_v<U, T>>>
+    CheckedSpan(const CheckedSpan<U>& other) : m_Data(other.Data()), m_Size(other.Size()) {}
+
+    T* Data() const { return m_Data; }
+    size_t Size() const { return m_Size; }
+    bool IsEmpty() const { return m_Size == 0; }
+
+    // range-for용 원시 포인터 (안쪽 루프에는 검사가 없음)
+    T* begin() const { return m_Data; }
+    T* end() const { return m_Data + m_Size; }
+
+    // 원소 하나 접근 (매번 검사)
+    T& operator[](size_t index) const {
+#if CHECKED_SPAN_POLICY != CHECKED_SPAN_POLICY_OFF
+        if (index >= m_Size) {
+            CheckedSpanDetail::ReportViolation("operator[]", index, 1, m_Size, m_Size > 0);
+            index = m_Size - 1;
+        }
+#endif
+        return m_Data[index];
+    }
+
+    // 호출 측이 이미 범위를 검사한 경우
+    T& Unchecked(size_t index) const { return m_Data[index]; }
+
+    // [offset, offset + count)를 한 번 검사해서 잘라냄. 벗어나면 빈 span (LOG)
+    CheckedSpan Subspan(size_t offset, size_t count) const {
+#if CHECKED_SPAN_POLICY != CHECKED_SPAN_POLICY_OFF
+        if (offset > m_Size || count > m_Size - offset) {
+            CheckedSpanDetail::ReportViolation("Subspan", offset, count, m_Size, true);
+            return CheckedSpan();
+        }
+#endif
+        return CheckedSpan(m_Data + offset, count);
+    }
+
+    CheckedSpan First(size_t count) const { return Subspan(0, count); }
+
+    CheckedSpan Last(size_t count) const {
+        return Subspan(count <= m_Size ? m_Size - count : m_Size + 1, count);
+    }
+
+private:
+    T*     m_Data = nullptr;
+    size_t m_Size = 0;
+};
+
+// 두 span을 나란히 순회: for (auto [p, v] : Zip(positions, velocities)) p += v * dt;
+template <typename A, typename B>
+class ZipRange {
+public:
+    struct Element {
+        A& first;
+        B& second;
+    };
+
+    class Iterator {
+    public:
+        Iterator(A* a, B* b) : m_A(a), m_B(b) {}
+        Element operator*() const { return Element{ *m_A, *m_B }; }
+        Iterator& operator++() {
+            ++m_A;
+            ++m_B;
+            return *this;
+        }
+        bool operator!=(const Iterator& other) const { return m_A != other.m_A; }
+
+    private:
+        A* m_A;
+        B* m_B;
+    };
+
+    ZipRange(A* a, B* b, size_t count) : m_A(a), m_B(b), m_Count(count) {}
+
+    Iterator begin() const { return Iterator(m_A, m_B); }
+    Iterator end() const { return Iterator(m_A + m_Count, m_B + m_Count); }
+    size_t Size() const { return m_Count; }
+
+private:
+    A*     m_A;
+    B*     m_B;
+    size_t m_Count;
+};
+
+// 크기가 다르면 정책에 따라 보고하고 짧은 쪽에 맞춤 (LOG)
+template <typename A, typename B>
+ZipRange<A, B> Zip(CheckedSpan<A> a, CheckedSpan<B> b) {
+    size_t count = a.Size() < b.Size() ? a.Size() : b.Size();
+#if CHECKED_SPAN_POLICY != CHECKED_SPAN_POLICY_OFF
+    if (a.Size() != b.Size()) {
+        CheckedSpanDetail::ReportViolation("Zip", a.Size(), b.Size(), count, true);
+    }
+#endif
+    return ZipRange<A, B>(a.Data(), b.Data(), count);
+}
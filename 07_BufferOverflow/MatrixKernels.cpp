@@ -0,0 +1,162 @@
+/*============================================================================
+ *  MatrixKernels.cpp - Scalar / SSE4.1 / AVX2 4x4 행렬 곱
+ *============================================================================*/
+#include "MatrixKernels.h"
+#include "SimdDispatch.h"
+
+#include <cstring>
+
+namespace MatrixKernels {
+
+namespace {
+
+// ----------------------------------------------------------------------------
+// Scalar
+// ----------------------------------------------------------------------------
+inline void MultiplyScalar(const float* a, const float* b, float* out) {
+    float r[16];
+    for (int i = 0; i < 4; i++) {
+        const float* row = a + i * 4;
+        for (int j = 0; j < 4; j++) {
+            float s = row[0] * b[j];
+            s += row[1] * b[4 + j];
+            s += row[2] * b[8 + j];
+            s += row[3] * b[12 + j];
+            r[i * 4 + j] = s;
+        }
+    }
+    memcpy(out, r, sizeof(r));
+}
+
+// ----------------------------------------------------------------------------
+// SSE4.1: 한 행씩 (a[i][k]를 4레인에 복제해서 b의 k행과 곱함)
+// ----------------------------------------------------------------------------
+SIMD_TARGET_SSE41 inline __m128 RowTimesMatrix(__m128 row, __m128 b0, __m128 b1, __m128 b2, __m128 b3) {
+    __m128 r = _mm_mul_ps(_mm_shuffle_ps(row, row, 0x00), b0);
+    r = _mm_add_ps(r, _mm_mul_ps(_mm_shuffle_ps(row, row, 0x55), b1));
+    r = _mm_add_ps(r, _mm_mul_ps(_mm_shuffle_ps(row, row, 0xAA), b2));
+    r = _mm_add_ps(r, _mm_mul_ps(_mm_shuffle_ps(row, row, 0xFF), b3));
+    return r;
+}
+
+SIMD_TARGET_SSE41 inline void MultiplySSE(const float* a, const float* b, float* out) {
+    __m128 b0 = _mm_loadu_ps(b);
+    __m128 b1 = _mm_loadu_ps(b + 4);
+    __m128 b2 = _mm_loadu_ps(b + 8);
+    __m128 b3 = _mm_loadu_ps(b + 12);
+    __m128 a0 = _mm_loadu_ps(a);
+    __m128 a1 = _mm_loadu_ps(a + 4);
+    __m128 a2 = _mm_loadu_ps(a + 8);
+    __m128 a3 = _mm_loadu_ps(a + 12);
+    _mm_storeu_ps(out, RowTimesMatrix(a0, b0, b1, b2, b3));
+    _mm_storeu_ps(out + 4, RowTimesMatrix(a1, b0, b1, b2, b3));
+    _mm_storeu_ps(out + 8, RowTimesMatrix(a2, b0, b1, b2, b3));
+    _mm_storeu_ps(out + 12, RowTimesMatrix(a3, b0, b1, b2, b3));
+}
+
+// ----------------------------------------------------------------------------
+// AVX2: 두 행씩 (b의 각 행을 위/아래 128비트에 복제)
+// ----------------------------------------------------------------------------
+SIMD_TARGET_AVX2 inline __m256 TwoRowsTimesMatrix(__m256 rows, __m256 b0, __m256 b1, __m256 b2, __m256 b3) {
+    __m256 r = _mm256_mul_ps(_mm256_permute_ps(rows, 0x00), b0);
+    r = _mm256_add_ps(r, _mm256_mul_ps(_mm256_permute_ps(rows, 0x55), b1));
+    r = _mm256_add_ps(r, _mm256_mul_ps(_mm256_permute_ps(rows, 0xAA), b2));
+    r = _mm256_add_ps(r, _mm256_mul_ps(_mm256_permute_ps(rows, 0xFF), b3));
+    return r;
+}
+
+SIMD_TARGET_AVX2 inline void MultiplyAVX2(const float* a, const float* b, float* out) {
+    __m256 b0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(b));
+    __m256 b1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(b + 4));
+    __m256 b2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(b + 8));
+    __m256 b3 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(b + 12));
+    __m256 a01 = _mm256_loadu_ps(a);
+    __m256 a23 = _mm256_loadu_ps(a + 8);
+    _mm256_storeu_ps(out, TwoRowsTimesMatrix(a01, b0, b1, b2, b3));
+    _mm256_storeu_ps(out + 8, TwoRowsTimesMatrix(a23, b0, b1, b2, b3));
+}
+
+// ----------------------------------------------------------------------------
+// 뼈대 단위 루프 (단계마다 한 벌씩, 안쪽 곱셈은 인라인)
+// ----------------------------------------------------------------------------
+void MultiplyMatricesScalar(const float* a, const float* b, float* out, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        size_t o = i * kFloatsPerMatrix;
+        MultiplyScalar(a + o, b + o, out + o);
+    }
+}
+
+SIMD_TARGET_SSE41 void MultiplyMatricesSSE(const float* a, const float* b, float* out, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        size_t o = i * kFloatsPerMatrix;
+        MultiplySSE(a + o, b + o, out + o);
+    }
+}
+
+SIMD_TARGET_AVX2 void MultiplyMatricesAVX2(const float* a, const float* b, float* out, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        size_t o = i * kFloatsPerMatrix;
+        MultiplyAVX2(a + o, b + o, out + o);
+    }
+}
+
+void ConcatenateScalar(const int32_t* parents, const float* local, float* model, size_t boneCount) {
+    for (size_t i = 0; i < boneCount; i++) {
+        size_t o = i * kFloatsPerMatrix;
+        if (parents[i] < 0) {
+            memcpy(model + o, local + o, kFloatsPerMatrix * sizeof(float));
+        } else {
+            MultiplyScalar(model + (size_t)parents[i] * kFloatsPerMatrix, local + o, model + o);
+        }
+    }
+}
+
+SIMD_TARGET_SSE41 void ConcatenateSSE(const int32_t* parents, const float* local, float* model, size_t boneCount) {
+    for (size_t i = 0; i < boneCount; i++) {
+        size_t o = i * kFloatsPerMatrix;
+        if (parents[i] < 0) {
+            memcpy(model + o, local + o, kFloatsPerMatrix * sizeof(float));
+        } else {
+            MultiplySSE(model + (size_t)parents[i] * kFloatsPerMatrix, local + o, model + o);
+        }
+    }
+}
+
+SIMD_TARGET_AVX2 void ConcatenateAVX2(const int32_t* parents, const float* local, float* model, size_t boneCount) {
+    for (size_t i = 0; i < boneCount; i++) {
+        size_t o = i * kFloatsPerMatrix;
+        if (parents[i] < 0) {
+            memcpy(model + o, local + o, kFloatsPerMatrix * sizeof(float));
+        } else {
+            MultiplyAVX2(model + (size_t)parents[i] * kFloatsPerMatrix, local + o, model + o);
+        }
+    }
+}
+
+} // namespace
+
+void Multiply(const float* a, const float* b, float* out) {
+    MultiplyMatrices(a, b, out, 1);
+}
+
+void MultiplyMatrices(const float* a, const float* b, float* out, size_t count) {
+    switch (GetSimdLevel()) {
+    case SimdLevel::AVX2:  MultiplyMatricesAVX2(a, b, out, count); break;
+    case SimdLevel::SSE41: MultiplyMatricesSSE(a, b, out, count); break;
+    default:               MultiplyMatricesScalar(a, b, out, count); break;
+    }
+}
+
+void ConcatenateHierarchy(const int32_t* parents, const float* local, float* model, size_t boneCount) {
+    switch (GetSimdLevel()) {
+    case SimdLevel::AVX2:  ConcatenateAVX2(parents, local, model, boneCount); break;
+    case SimdLevel::SSE41: ConcatenateSSE(parents, local, model, boneCount); break;
+    default:               ConcatenateScalar(parents, local, model, boneCount); break;
+    }
+}
+
+void ApplyInverseBind(const float* model, const float* inverseBind, float* skin, size_t boneCount) {
+    MultiplyMatrices(model, inverseBind, skin, boneCount);
+}
+
+} // namespace MatrixKernels
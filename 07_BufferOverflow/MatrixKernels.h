@@ -0,0 +1,37 @@
+/*============================================================================
+ *  MatrixKernels - 4x4 행렬 팔레트 SIMD 커널 (본 포즈 계산)
+ *  ---------------------------------------------------------------------------
+ *  행렬은 float[16] 행 우선(row-major) 저장, 열 벡터 규약(v' = M * v)입니다.
+ *
+ *      out = a * b  →  out의 i행 = a[i][0]*b0행 + a[i][1]*b1행 + a[i][2]*b2행 + a[i][3]*b3행
+ *
+ *  SSE4.1은 한 행(4 float)을, AVX2는 두 행(8 float)을 한 번에 계산합니다.
+ *  모든 커널이 같은 순서로 곱하고 더하며 FMA를 쓰지 않으므로 결과가 비트 단위로 같습니다.
+ *  커널은 SimdDispatch로 실행 시 선택되며, 한 번의 호출 안에서 뼈대 전체를 처리해서
+ *  분기는 호출당 한 번뿐입니다.
+ *
+ *  - MultiplyMatrices   : out[i] = a[i] * b[i]
+ *  - ConcatenateHierarchy: model[i] = model[parent[i]] * local[i] (루트는 local 그대로)
+ *  - ApplyInverseBind   : skin[i] = model[i] * inverseBind[i]
+ *
+ *  out은 입력과 겹치면 안 됩니다 (ConcatenateHierarchy의 model은 예외: 부모 행렬만 읽음).
+ *============================================================================*/
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace MatrixKernels {
+
+constexpr size_t kFloatsPerMatrix = 16;
+
+void Multiply(const float* a, const float* b, float* out);
+
+void MultiplyMatrices(const float* a, const float* b, float* out, size_t count);
+
+// parents[i] < i (부모가 먼저 나와야 함), 루트는 -1
+void ConcatenateHierarchy(const int32_t* parents, const float* local, float* model, size_t boneCount);
+
+void ApplyInverseBind(const float* model, const float* inverseBind, float* skin, size_t boneCount);
+
+} // namespace MatrixKernels
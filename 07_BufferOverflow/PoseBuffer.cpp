@@ -0,0 +1,51 @@
+/*============================================================================
+ *  PoseBuffer.cpp - 아레나 할당과 포즈 계산
+ *============================================================================*/
+#include "PoseBuffer.h"
+
+#include <new>
+
+PoseArena::PoseArena(size_t capacityBytes)
+    : m_Memory(nullptr), m_Capacity(capacityBytes), m_Used(0) {
+    m_Memory = static_cast<char*>(::operator new(capacityBytes, std::align_val_t(kAlignment)));
+}
+
+PoseArena::~PoseArena() {
+    ::operator delete(m_Memory, std::align_val_t(kAlignment));
+}
+
+void* PoseArena::Allocate(size_t bytes) {
+    size_t rounded = (bytes + kAlignment - 1) & ~(kAlignment - 1);
+    if (rounded < bytes || rounded > m_Capacity - m_Used) return nullptr;
+    void* block = m_Memory + m_Used;
+    m_Used += rounded;
+    return block;
+}
+
+bool Skeleton::IsValid() const {
+    if (inverseBind.size() != parents.size() * MatrixKernels::kFloatsPerMatrix) return false;
+    for (size_t i = 0; i < parents.size(); i++) {
+        if (parents[i] >= (int32_t)i) return false;
+    }
+    return true;
+}
+
+bool PoseBuffer::Allocate(PoseArena& arena, uint32_t boneCount) {
+    size_t bytes = (size_t)boneCount * kFloatsPerMatrix * sizeof(float);
+    if (boneCount == 0 || bytes * 3 > arena.GetCapacityBytes() - arena.GetUsedBytes()) return false;
+
+    m_Local = static_cast<float*>(arena.Allocate(bytes));
+    m_Model = static_cast<float*>(arena.Allocate(bytes));
+    m_Skin = static_cast<float*>(arena.Allocate(bytes));
+    m_BoneCount = boneCount;
+    return true;
+}
+
+// 커널은 부모 인덱스와 역바인드 행렬 수를 믿고 읽으므로, 유효하지 않은 뼈대는 여기서 거부
+// (부모가 뒤에 있으면 계산 전 행렬이나 범위 밖을, 역바인드가 모자라면 vector 끝 너머를 읽음)
+bool PoseBuffer::Compute(const Skeleton& skeleton) {
+    if (skeleton.GetBoneCount() != m_BoneCount || !skeleton.IsValid()) return false;
+    MatrixKernels::ConcatenateHierarchy(skeleton.parents.data(), m_Local, m_Model, m_BoneCount);
+    MatrixKernels::ApplyInverseBind(m_Model, skeleton.inverseBind.data(), m_Skin, m_BoneCount);
+    return true;
+}
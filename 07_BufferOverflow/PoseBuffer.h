@@ -0,0 +1,99 @@
+/*============================================================================
+ *  PoseBuffer - 정렬 아레나 위의 가변 크기 본 포즈 버퍼
+ *  ---------------------------------------------------------------------------
+ *  BonePoseBuffer(BUG C)는 float[4][16]으로 크기가 고정되어 있어서
+ *  본이 4개를 넘는 뼈대를 쓰는 순간 스택을 덮어씁니다.
+ *
+ *  PoseBuffer는 뼈대의 본 수만큼 행렬 배열 3개를 PoseArena에서 잘라 씁니다:
+ *
+ *      local  (애니메이션 결과, 부모 기준)
+ *      model  (ConcatenateHierarchy: 모델 공간)
+ *      skin   (ApplyInverseBind: 스키닝에 바로 쓰는 팔레트)
+ *
+ *  PoseArena는 64바이트 정렬 선형 할당기라서 캐릭터 수천 명의 포즈가
+ *  한 메모리 블록에 연속으로 놓이고, 프레임마다 Reset()으로 통째로 비웁니다.
+ *  공간이 모자라면 Allocate()가 false를 돌려주며 절대 범위 밖에 쓰지 않습니다.
+ *
+ *  본 접근(GetLocal 등)은 Debug에서 assert로 범위를 검사합니다.
+ *============================================================================*/
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "MatrixKernels.h"
+
+// 64바이트 정렬 선형 할당기 (개별 해제 없음, Reset으로 전체 비움)
+class PoseArena {
+public:
+    static constexpr size_t kAlignment = 64;
+
+    // capacityBytes만큼 한 번에 확보 (실패 시 std::bad_alloc)
+    explicit PoseArena(size_t capacityBytes);
+    ~PoseArena();
+
+    PoseArena(const PoseArena&) = delete;
+    PoseArena& operator=(const PoseArena&) = delete;
+
+    // 64바이트 정렬된 bytes 크기 블록. 공간이 모자라면 nullptr
+    void* Allocate(size_t bytes);
+    void Reset() { m_Used = 0; }
+
+    size_t GetUsedBytes() const { return m_Used; }
+    size_t GetCapacityBytes() const { return m_Capacity; }
+
+private:
+    char*  m_Memory;
+    size_t m_Capacity;
+    size_t m_Used;
+};
+
+// 본 계층 (부모 인덱스)과 본별 역바인드 행렬
+struct Skeleton {
+    std::vector<int32_t> parents;       // parents[i] < i, 루트는 -1
+    std::vector<float>   inverseBind;   // 본 수 x 16
+
+    uint32_t GetBoneCount() const { return (uint32_t)parents.size(); }
+
+    // 부모가 항상 먼저 나오고 역바인드 행렬 수가 맞는지
+    bool IsValid() const;
+};
+
+class PoseBuffer {
+public:
+    static constexpr size_t kFloatsPerMatrix = MatrixKernels::kFloatsPerMatrix;
+
+    PoseBuffer() = default;
+
+    // 본 boneCount개 분량(local/model/skin)을 arena에서 확보. 공간이 모자라면 false
+    bool Allocate(PoseArena& arena, uint32_t boneCount);
+
+    uint32_t GetBoneCount() const { return m_BoneCount; }
+
+    float* GetLocal(uint32_t bone) {
+        assert(bone < m_BoneCount);
+        return m_Local + bone * kFloatsPerMatrix;
+    }
+    const float* GetModel(uint32_t bone) const {
+        assert(bone < m_BoneCount);
+        return m_Model + bone * kFloatsPerMatrix;
+    }
+    const float* GetSkin(uint32_t bone) const {
+        assert(bone < m_BoneCount);
+        return m_Skin + bone * kFloatsPerMatrix;
+    }
+
+    float* GetLocalData() { return m_Local; }
+    const float* GetSkinData() const { return m_Skin; }
+
+    // local → model → skin. 뼈대의 본 수가 버퍼와 다르거나 IsValid()가 아니면 아무것도 하지 않고 false
+    bool Compute(const Skeleton& skeleton);
+
+private:
+    float*   m_Local = nullptr;
+    float*   m_Model = nullptr;
+    float*   m_Skin = nullptr;
+    uint32_t m_BoneCount = 0;
+};
@@ -0,0 +1,396 @@
+/*============================================================================
+ *  Utf8Transcode.cpp - 스칼라 코드 포인트 변환 + ASCII 블록 SIMD 커널
+ *============================================================================*/
+#include "Utf8Transcode.h"
+#include "SimdDispatch.h"
+
+#include <algorithm>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace Utf8Transcode {
+
+namespace {
+
+constexpr char32_t kReplacement = 0xFFFD;
+
+inline unsigned CountTrailingZeros(unsigned v) {
+#if defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward(&index, v);
+    return (unsigned)index;
+#else
+    return (unsigned)__builtin_ctz(v);
+#endif
+}
+
+// ----------------------------------------------------------------------------
+// 스칼라: 코드 포인트 하나씩 (검증 포함)
+// ----------------------------------------------------------------------------
+
+// UTF-8 한 코드 포인트. 잘못된 시퀀스면 유효한 앞부분까지 소비하고 U+FFFD (Unicode 표 3-7)
+char32_t DecodeUtf8(const unsigned char* s, size_t remaining, size_t& consumed, bool& valid) {
+    unsigned char b0 = s[0];
+    valid = false;
+    consumed = 1;
+    if (b0 < 0x80) {
+        valid = true;
+        return b0;
+    }
+
+    int need;
+    char32_t cp;
+    unsigned char lo = 0x80, hi = 0xBF;
+    if (b0 >= 0xC2 && b0 <= 0xDF) {
+        need = 1;
+        cp = b0 & 0x1F;
+    } else if (b0 >= 0xE0 && b0 <= 0xEF) {
+        need = 2;
+        cp = b0 & 0x0F;
+        if (b0 == 0xE0) lo = 0xA0;          // 긴 인코딩
+        else if (b0 == 0xED) hi = 0x9F;     // 서로게이트 (U+D800~DFFF)
+    } else if (b0 >= 0xF0 && b0 <= 0xF4) {
+        need = 3;
+        cp = b0 & 0x07;
+        if (b0 == 0xF0) lo = 0x90;          // 긴 인코딩
+        else if (b0 == 0xF4) hi = 0x8F;     // U+10FFFF 초과
+    } else {
+        return kReplacement;
+    }
+
+    size_t i = 1;
+    for (int k = 0; k < need; k++, i++) {
+        if (i >= remaining || s[i] < lo || s[i] > hi) {
+            consumed = i;
+            return kReplacement;
+        }
+        cp = (cp << 6) | (s[i] & 0x3F);
+        lo = 0x80;
+        hi = 0xBF;
+    }
+    consumed = i;
+    valid = true;
+    return cp;
+}
+
+inline size_t Utf8Length(char32_t cp) {
+    return cp < 0x80 ? 1 : cp < 0x800 ? 2 : cp < 0x10000 ? 3 : 4;
+}
+
+inline void EncodeUtf8(char32_t cp, char* out) {
+    if (cp < 0x80) {
+        out[0] = (char)cp;
+    } else if (cp < 0x800) {
+        out[0] = (char)(0xC0 | (cp >> 6));
+        out[1] = (char)(0x80 | (cp & 0x3F));
+    } else if (cp < 0x10000) {
+        out[0] = (char)(0xE0 | (cp >> 12));
+        out[1] = (char)(0x80 | ((cp >> 6) & 0x3F));
+        out[2] = (char)(0x80 | (cp & 0x3F));
+    } else {
+        out[0] = (char)(0xF0 | (cp >> 18));
+        out[1] = (char)(0x80 | ((cp >> 12) & 0x3F));
+        out[2] = (char)(0x80 | ((cp >> 6) & 0x3F));
+        out[3] = (char)(0x80 | (cp & 0x3F));
+    }
+}
+
+inline bool IsSurrogate(char32_t cp) { return cp >= 0xD800 && cp <= 0xDFFF; }
+
+// ASCII 블록 커널: 앞쪽의 ASCII 구간을 블록 단위로 변환하고 처리한 단위 수를 돌려줌
+// (n = min(입력, 출력 공간). 첫 블록에 비ASCII가 있으면 0일 수 있음)
+using Utf8ToUtf16Block = size_t (*)(const char*, char16_t*, size_t n);
+using Utf16ToUtf8Block = size_t (*)(const char16_t*, char*, size_t n);
+using Utf8ToUtf32Block = size_t (*)(const char*, char32_t*, size_t n);
+using Utf32ToUtf8Block = size_t (*)(const char32_t*, char*, size_t n);
+
+size_t NoBlock8To16(const char*, char16_t*, size_t) { return 0; }
+size_t NoBlock16To8(const char16_t*, char*, size_t) { return 0; }
+size_t NoBlock8To32(const char*, char32_t*, size_t) { return 0; }
+size_t NoBlock32To8(const char32_t*, char*, size_t) { return 0; }
+
+// ----------------------------------------------------------------------------
+// SSE4.1
+// ----------------------------------------------------------------------------
+SIMD_TARGET_SSE41 size_t Block8To16SSE(const char* src, char16_t* dst, size_t n) {
+    const __m128i zero = _mm_setzero_si128();
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_unpacklo_epi8(v, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i + 8), _mm_unpackhi_epi8(v, zero));
+        // 비ASCII 앞까지만 인정 (뒤쪽은 스칼라가 덮어씀)
+        unsigned mask = (unsigned)_mm_movemask_epi8(v);
+        if (mask) return i + CountTrailingZeros(mask);
+    }
+    return i;
+}
+
+SIMD_TARGET_SSE41 size_t Block16To8SSE(const char16_t* src, char* dst, size_t n) {
+    const __m128i nonAscii = _mm_set1_epi16((short)0xFF80);
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + 8));
+        if (!_mm_testz_si128(_mm_or_si128(a, b), nonAscii)) break;
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_packus_epi16(a, b));
+    }
+    return i;
+}
+
+SIMD_TARGET_SSE41 size_t Block8To32SSE(const char* src, char32_t* dst, size_t n) {
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        __m128i* out = reinterpret_cast<__m128i*>(dst + i);
+        _mm_storeu_si128(out, _mm_cvtepu8_epi32(v));
+        _mm_storeu_si128(out + 1, _mm_cvtepu8_epi32(_mm_srli_si128(v, 4)));
+        _mm_storeu_si128(out + 2, _mm_cvtepu8_epi32(_mm_srli_si128(v, 8)));
+        _mm_storeu_si128(out + 3, _mm_cvtepu8_epi32(_mm_srli_si128(v, 12)));
+        unsigned mask = (unsigned)_mm_movemask_epi8(v);
+        if (mask) return i + CountTrailingZeros(mask);
+    }
+    return i;
+}
+
+SIMD_TARGET_SSE41 size_t Block32To8SSE(const char32_t* src, char* dst, size_t n) {
+    const __m128i nonAscii = _mm_set1_epi32((int)0xFFFFFF80u);
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        const __m128i* in = reinterpret_cast<const __m128i*>(src + i);
+        __m128i a = _mm_loadu_si128(in);
+        __m128i b = _mm_loadu_si128(in + 1);
+        __m128i c = _mm_loadu_si128(in + 2);
+        __m128i d = _mm_loadu_si128(in + 3);
+        __m128i any = _mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d));
+        if (!_mm_testz_si128(any, nonAscii)) break;
+        __m128i ab = _mm_packus_epi32(a, b);
+        __m128i cd = _mm_packus_epi32(c, d);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_packus_epi16(ab, cd));
+    }
+    return i;
+}
+
+// ----------------------------------------------------------------------------
+// AVX2
+// ----------------------------------------------------------------------------
+SIMD_TARGET_AVX2 size_t Block8To16AVX2(const char* src, char16_t* dst, size_t n) {
+    size_t i = 0;
+    for (; i + 32 <= n; i += 32) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+        __m256i* out = reinterpret_cast<__m256i*>(dst + i);
+        _mm256_storeu_si256(out, _mm256_cvtepu8_epi16(_mm256_castsi256_si128(v)));
+        _mm256_storeu_si256(out + 1, _mm256_cvtepu8_epi16(_mm256_extracti128_si256(v, 1)));
+        unsigned mask = (unsigned)_mm256_movemask_epi8(v);
+        if (mask) return i + CountTrailingZeros(mask);
+    }
+    return i + Block8To16SSE(src + i, dst + i, n - i);
+}
+
+SIMD_TARGET_AVX2 size_t Block16To8AVX2(const char16_t* src, char* dst, size_t n) {
+    const __m256i nonAscii = _mm256_set1_epi16((short)0xFF80);
+    size_t i = 0;
+    for (; i + 32 <= n; i += 32) {
+        __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+        __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i + 16));
+        if (!_mm256_testz_si256(_mm256_or_si256(a, b), nonAscii)) break;
+        // packus는 128비트 레인별로 섞이므로 64비트 조각 순서를 되돌림
+        __m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi16(a, b), 0xD8);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), packed);
+    }
+    return i + Block16To8SSE(src + i, dst + i, n - i);
+}
+
+SIMD_TARGET_AVX2 size_t Block8To32AVX2(const char* src, char32_t* dst, size_t n) {
+    size_t i = 0;
+    for (; i + 32 <= n; i += 32) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+        __m128i lo = _mm256_castsi256_si128(v);
+        __m128i hi = _mm256_extracti128_si256(v, 1);
+        __m256i* out = reinterpret_cast<__m256i*>(dst + i);
+        _mm256_storeu_si256(out, _mm256_cvtepu8_epi32(lo));
+        _mm256_storeu_si256(out + 1, _mm256_cvtepu8_epi32(_mm_srli_si128(lo, 8)));
+        _mm256_storeu_si256(out + 2, _mm256_cvtepu8_epi32(hi));
+        _mm256_storeu_si256(out + 3, _mm256_cvtepu8_epi32(_mm_srli_si128(hi, 8)));
+        unsigned mask = (unsigned)_mm256_movemask_epi8(v);
+        if (mask) return i + CountTrailingZeros(mask);
+    }
+    return i + Block8To32SSE(src + i, dst + i, n - i);
+}
+
+SIMD_TARGET_AVX2 size_t Block32To8AVX2(const char32_t* src, char* dst, size_t n) {
+    const __m256i nonAscii = _mm256_set1_epi32((int)0xFFFFFF80u);
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+        __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i + 8));
+        if (!_mm256_testz_si256(_mm256_or_si256(a, b), nonAscii)) break;
+        __m256i words = _mm256_permute4x64_epi64(_mm256_packus_epi32(a, b), 0xD8);
+        __m128i bytes = _mm_packus_epi16(_mm256_castsi256_si128(words), _mm256_extracti128_si256(words, 1));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), bytes);
+    }
+    return i;
+}
+
+// ----------------------------------------------------------------------------
+// 공통 루프: ASCII 블록 커널 → 막히면 비ASCII 구간을 스칼라로
+// ----------------------------------------------------------------------------
+TranscodeResult Utf8ToUtf16Loop(const char* src, size_t length, char16_t* dst, size_t capacity,
+                                Utf8ToUtf16Block block) {
+    const unsigned char* s = reinterpret_cast<const unsigned char*>(src);
+    TranscodeResult r;
+    while (r.read < length) {
+        size_t n = block(src + r.read, dst + r.written, std::min(length - r.read, capacity - r.written));
+        r.read += n;
+        r.written += n;
+        if (r.read >= length) break;
+
+        // 적어도 한 코드 포인트, 그 뒤로 비ASCII가 이어지는 동안 계속
+        do {
+            size_t consumed;
+            bool valid;
+            char32_t cp = DecodeUtf8(s + r.read, length - r.read, consumed, valid);
+            size_t units = cp >= 0x10000 ? 2 : 1;
+            if (units > capacity - r.written) {
+                r.truncated = true;
+                return r;
+            }
+            if (cp >= 0x10000) {
+                cp -= 0x10000;
+                dst[r.written] = (char16_t)(0xD800 + (cp >> 10));
+                dst[r.written + 1] = (char16_t)(0xDC00 + (cp & 0x3FF));
+            } else {
+                dst[r.written] = (char16_t)cp;
+            }
+            r.written += units;
+            r.read += consumed;
+            if (!valid) r.replaced++;
+        } while (r.read < length && s[r.read] >= 0x80);
+    }
+    return r;
+}
+
+TranscodeResult Utf16ToUtf8Loop(const char16_t* src, size_t length, char* dst, size_t capacity,
+                                Utf16ToUtf8Block block) {
+    TranscodeResult r;
+    while (r.read < length) {
+        size_t n = block(src + r.read, dst + r.written, std::min(length - r.read, capacity - r.written));
+        r.read += n;
+        r.written += n;
+        if (r.read >= length) break;
+
+        do {
+            char32_t cp = src[r.read];
+            size_t consumed = 1;
+            bool valid = true;
+            if (cp >= 0xD800 && cp <= 0xDBFF && r.read + 1 < length &&
+                src[r.read + 1] >= 0xDC00 && src[r.read + 1] <= 0xDFFF) {
+                cp = 0x10000 + ((cp - 0xD800) << 10) + (src[r.read + 1] - 0xDC00);
+                consumed = 2;
+            } else if (IsSurrogate(cp)) {
+                cp = kReplacement;
+                valid = false;
+            }
+            size_t bytes = Utf8Length(cp);
+            if (bytes > capacity - r.written) {
+                r.truncated = true;
+                return r;
+            }
+            EncodeUtf8(cp, dst + r.written);
+            r.written += bytes;
+            r.read += consumed;
+            if (!valid) r.replaced++;
+        } while (r.read < length && src[r.read] >= 0x80);
+    }
+    return r;
+}
+
+TranscodeResult Utf8ToUtf32Loop(const char* src, size_t length, char32_t* dst, size_t capacity,
+                                Utf8ToUtf32Block block) {
+    const unsigned char* s = reinterpret_cast<const unsigned char*>(src);
+    TranscodeResult r;
+    while (r.read < length) {
+        size_t n = block(src + r.read, dst + r.written, std::min(length - r.read, capacity - r.written));
+        r.read += n;
+        r.written += n;
+        if (r.read >= length) break;
+
+        do {
+            if (r.written == capacity) {
+                r.truncated = true;
+                return r;
+            }
+            size_t consumed;
+            bool valid;
+            dst[r.written++] = DecodeUtf8(s + r.read, length - r.read, consumed, valid);
+            r.read += consumed;
+            if (!valid) r.replaced++;
+        } while (r.read < length && s[r.read] >= 0x80);
+    }
+    return r;
+}
+
+TranscodeResult Utf32ToUtf8Loop(const char32_t* src, size_t length, char* dst, size_t capacity,
+                                Utf32ToUtf8Block block) {
+    TranscodeResult r;
+    while (r.read < length) {
+        size_t n = block(src + r.read, dst + r.written, std::min(length - r.read, capacity - r.written));
+        r.read += n;
+        r.written += n;
+        if (r.read >= length) break;
+
+        do {
+            char32_t cp = src[r.read];
+            bool valid = cp <= 0x10FFFF && !IsSurrogate(cp);
+            if (!valid) cp = kReplacement;
+            size_t bytes = Utf8Length(cp);
+            if (bytes > capacity - r.written) {
+                r.truncated = true;
+                return r;
+            }
+            EncodeUtf8(cp, dst + r.written);
+            r.written += bytes;
+            r.read++;
+            if (!valid) r.replaced++;
+        } while (r.read < length && src[r.read] >= 0x80);
+    }
+    return r;
+}
+
+} // namespace
+
+TranscodeResult Utf8ToUtf16(const char* src, size_t srcLength, char16_t* dst, size_t dstCapacity) {
+    switch (GetSimdLevel()) {
+    case SimdLevel::AVX2:  return Utf8ToUtf16Loop(src, srcLength, dst, dstCapacity, Block8To16AVX2);
+    case SimdLevel::SSE41: return Utf8ToUtf16Loop(src, srcLength, dst, dstCapacity, Block8To16SSE);
+    default:               return Utf8ToUtf16Loop(src, srcLength, dst, dstCapacity, NoBlock8To16);
+    }
+}
+
+TranscodeResult Utf16ToUtf8(const char16_t* src, size_t srcLength, char* dst, size_t dstCapacity) {
+    switch (GetSimdLevel()) {
+    case SimdLevel::AVX2:  return Utf16ToUtf8Loop(src, srcLength, dst, dstCapacity, Block16To8AVX2);
+    case SimdLevel::SSE41: return Utf16ToUtf8Loop(src, srcLength, dst, dstCapacity, Block16To8SSE);
+    default:               return Utf16ToUtf8Loop(src, srcLength, dst, dstCapacity, NoBlock16To8);
+    }
+}
+
+TranscodeResult Utf8ToUtf32(const char* src, size_t srcLength, char32_t* dst, size_t dstCapacity) {
+    switch (GetSimdLevel()) {
+    case SimdLevel::AVX2:  return Utf8ToUtf32Loop(src, srcLength, dst, dstCapacity, Block8To32AVX2);
+    case SimdLevel::SSE41: return Utf8ToUtf32Loop(src, srcLength, dst, dstCapacity, Block8To32SSE);
+    default:               return Utf8ToUtf32Loop(src, srcLength, dst, dstCapacity, NoBlock8To32);
+    }
+}
+
+TranscodeResult Utf32ToUtf8(const char32_t* src, size_t srcLength, char* dst, size_t dstCapacity) {
+    switch (GetSimdLevel()) {
+    case SimdLevel::AVX2:  return Utf32ToUtf8Loop(src, srcLength, dst, dstCapacity, Block32To8AVX2);
+    case SimdLevel::SSE41: return Utf32ToUtf8Loop(src, srcLength, dst, dstCapacity, Block32To8SSE);
+    default:               return Utf32ToUtf8Loop(src, srcLength, dst, dstCapacity, NoBlock32To8);
+    }
+}
+
+} // namespace Utf8Transcode
@@ -0,0 +1,36 @@
+/*============================================================================
+ *  Utf8Transcode - UTF-8 ↔ UTF-16 / UTF-32 변환 (SIMD ASCII 구간 가속)
+ *  ---------------------------------------------------------------------------
+ *  BUG E처럼 고정 크기 버퍼에 글자 단위로 옮기는 변환 루프는
+ *  경로/로그 문자열 수백만 개를 처리하면 프로파일에 그대로 드러납니다.
+ *
+ *  실제 경로와 로그는 대부분 ASCII입니다. 그래서 변환기는
+ *  - 16/32바이트 블록을 읽어 최상위 비트가 하나도 없으면(ASCII) 한 번에 넓히거나 좁히고
+ *  - 비ASCII가 섞인 블록만 한 코드 포인트씩 스칼라로 처리합니다.
+ *  커널은 SimdDispatch로 실행 시 선택됩니다 (AVX2 → SSE4.1 → Scalar).
+ *
+ *  모든 함수는 출력 버퍼 크기를 넘지 않습니다. 공간이 모자라면 코드 포인트 경계에서
+ *  멈추고 truncated를 표시합니다. 잘못된 입력(잘린 시퀀스, 긴 인코딩, 서로게이트,
+ *  U+10FFFF 초과, 짝 없는 UTF-16 서로게이트)은 U+FFFD로 바꾸고 replaced에 셉니다.
+ *  출력에 '\0'을 붙이지 않습니다 (길이는 written). 블록 단위로 먼저 쓰기 때문에
+ *  written 뒤부터 dstCapacity까지의 내용은 정해져 있지 않습니다.
+ *============================================================================*/
+#pragma once
+
+#include <cstddef>
+
+struct TranscodeResult {
+    size_t read = 0;            // 소비한 입력 단위 수
+    size_t written = 0;         // 쓴 출력 단위 수
+    size_t replaced = 0;        // U+FFFD로 바꾼 잘못된 시퀀스 수
+    bool   truncated = false;   // 출력 공간이 모자라 중간에 멈춤
+};
+
+namespace Utf8Transcode {
+
+TranscodeResult Utf8ToUtf16(const char* src, size_t srcLength, char16_t* dst, size_t dstCapacity);
+TranscodeResult Utf16ToUtf8(const char16_t* src, size_t srcLength, char* dst, size_t dstCapacity);
+TranscodeResult Utf8ToUtf32(const char* src, size_t srcLength, char32_t* dst, size_t dstCapacity);
+TranscodeResult Utf32ToUtf8(const char32_t* src, size_t srcLength, char* dst, size_t dstCapacity);
+
+} // namespace Utf8Transcode
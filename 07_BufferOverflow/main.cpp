@@ -14,6 +14,18 @@
 #include <string>
 #include <cstring>
 #include <cstdio>
+#include <chrono>
+#include <random>
+#include <cmath>
+#include <sstream>
+#include <iomanip>
+
+#include "CheckedSpan.h"
+#include "FixedFormat.h"
+#include "PoseBuffer.h"
+#include "SafeFilename.h"
+#include "SimdDispatch.h"
+#include "Utf8Transcode.h"
 
 // ============================================================================
 // BUG A: 빈 벡터 접근
@@ -136,6 +148,488 @@ void BugE_WcharBufferOverflow() {
     std::cout << "  이 메시지는 보이지 않을 것입니다.\n";
 }
 
+// ============================================================================
+// F: 정렬 아레나 PoseBuffer + SIMD 4x4 행렬 팔레트 커널
+// ============================================================================
+// fn을 rounds번 실행해서 가장 빠른 시간(ms)을 돌려줌. prepare는 측정에서 제외
+template <typename Prepare, typename Fn>
+double MeasureBestMs(int rounds, Prepare prepare, Fn fn) {
+    double best = 1e30;
+    for (int r = 0; r < rounds; r++) {
+        prepare();
+        auto start = std::chrono::steady_clock::now();
+        fn();
+        auto end = std::chrono::steady_clock::now();
+        double ms = std::chrono::duration<double, std::milli>(end - start).count();
+        if (ms < best) best = ms;
+    }
+    return best;
+}
+
+// 비교용: 원소 하나씩 쓰는 행렬 곱 (BonePoseBuffer에 쓰던 방식)
+void NaiveMultiply(const float* a, const float* b, float* out) {
+    for (int i = 0; i < 4; i++) {
+        for (int j = 0; j < 4; j++) {
+            float s = 0.0f;
+            for (int k = 0; k < 4; k++) s += a[i * 4 + k] * b[k * 4 + j];
+            out[i * 4 + j] = s;
+        }
+    }
+}
+
+// 회전(Z축 a, X축 b) + 이동
+void MakeBoneMatrix(float a, float b, float tx, float ty, float tz, float* out) {
+    float rz[16] = { cosf(a), -sinf(a), 0, 0,  sinf(a), cosf(a), 0, 0,  0, 0, 1, 0,  0, 0, 0, 1 };
+    float rx[16] = { 1, 0, 0, 0,  0, cosf(b), -sinf(b), 0,  0, sinf(b), cosf(b), 0,  0, 0, 0, 1 };
+    NaiveMultiply(rz, rx, out);
+    out[3] = tx;
+    out[7] = ty;
+    out[11] = tz;
+}
+
+// 캐릭터마다 따로 잡은 vector 3개
+struct NaiveCharacterPose {
+    std::vector<float> local, model, skin;
+};
+
+void BenchmarkPoseBuffer() {
+    std::cout << "\n[F] 정렬 아레나 PoseBuffer + SIMD 4x4 행렬 팔레트 커널\n";
+    std::cout << "  뼈대 크기만큼 아레나에서 잘라 쓰고, 계층 합성/역바인드를 SIMD로 계산합니다.\n";
+    std::cout << "  (Debug 빌드에서는 수치가 크게 왜곡되므로 Release에서 측정하세요)\n\n";
+
+    // 1) BUG C와 비교: 본 10개도 범위 안에서 기록, 공간이 모자라면 Allocate 실패
+    {
+        PoseArena smallArena(2048);
+        PoseBuffer pose;
+        bool ok = pose.Allocate(smallArena, 10);
+        for (uint32_t i = 0; i < pose.GetBoneCount(); i++) {
+            for (int j = 0; j < 16; j++) pose.GetLocal(i)[j] = (float)(i * 16 + j);
+        }
+        PoseBuffer tooBig;
+        bool tooBigOk = tooBig.Allocate(smallArena, 10);
+        std::cout << "  본 10개 PoseBuffer: " << (ok ? "할당/기록 완료" : "실패")
+                  << " (아레나 " << smallArena.GetUsedBytes() << "/" << smallArena.GetCapacityBytes()
+                  << " B), 남은 공간보다 큰 요청: " << (tooBigOk ? "성공?!" : "false") << "\n\n";
+    }
+
+    const uint32_t CHARACTERS = 1000;
+    const uint32_t BONES = 100;
+    const int ROUNDS = 5;
+    const size_t FPM = PoseBuffer::kFloatsPerMatrix;
+    SimdLevel supported = GetSupportedSimdLevel();
+
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<float> angle(-3.14159f, 3.14159f);
+    std::uniform_real_distribution<float> offset(-0.5f, 0.5f);
+
+    Skeleton skeleton;
+    skeleton.parents.resize(BONES);
+    skeleton.inverseBind.resize(BONES * FPM);
+    for (uint32_t i = 0; i < BONES; i++) {
+        skeleton.parents[i] = i == 0 ? -1 : (int32_t)((i - 1) / 2);
+        MakeBoneMatrix(angle(rng), angle(rng), offset(rng), offset(rng), offset(rng),
+                       &skeleton.inverseBind[i * FPM]);
+    }
+    std::cout << "  캐릭터 " << CHARACTERS << "명 x 본 " << BONES << "개, 뼈대 유효? "
+              << skeleton.IsValid() << ", CPU 지원 단계: " << GetSimdLevelName(supported) << "\n\n";
+
+    // 캐릭터별 local 포즈 (두 방식에 같은 값)
+    PoseArena arena((size_t)CHARACTERS * BONES * FPM * sizeof(float) * 3);
+    std::vector<PoseBuffer> poses(CHARACTERS);
+    std::vector<NaiveCharacterPose> naive(CHARACTERS);
+    for (uint32_t c = 0; c < CHARACTERS; c++) {
+        poses[c].Allocate(arena, BONES);
+        naive[c].local.resize(BONES * FPM);
+        naive[c].model.resize(BONES * FPM);
+        naive[c].skin.resize(BONES * FPM);
+        for (uint32_t b = 0; b < BONES; b++) {
+            MakeBoneMatrix(angle(rng), angle(rng), offset(rng), offset(rng), offset(rng),
+                           poses[c].GetLocal(b));
+            memcpy(&naive[c].local[b * FPM], poses[c].GetLocal(b), FPM * sizeof(float));
+        }
+    }
+
+    // 2) 기준: 캐릭터별 vector + 원소 단위 행렬 곱
+    double naiveMs = MeasureBestMs(ROUNDS, [] {}, [&] {
+        for (NaiveCharacterPose& p : naive) {
+            for (uint32_t b = 0; b < BONES; b++) {
+                int32_t parent = skeleton.parents[b];
+                if (parent < 0) {
+                    memcpy(&p.model[b * FPM], &p.local[b * FPM], FPM * sizeof(float));
+                } else {
+                    NaiveMultiply(&p.model[parent * FPM], &p.local[b * FPM], &p.model[b * FPM]);
+                }
+                NaiveMultiply(&p.model[b * FPM], &skeleton.inverseBind[b * FPM], &p.skin[b * FPM]);
+            }
+        }
+    });
+    std::cout << "  캐릭터별 vector + 원소 단위 곱 : " << naiveMs << " ms/프레임\n";
+
+    // 3) 아레나 PoseBuffer + 단계별 커널, 결과는 기준과 비트 단위 비교
+    const SimdLevel levels[] = { SimdLevel::Scalar, SimdLevel::SSE41, SimdLevel::AVX2 };
+    size_t totalMismatches = 0;
+    for (SimdLevel level : levels) {
+        if (level > supported) continue;
+        SetSimdLevel(level);
+
+        double ms = MeasureBestMs(ROUNDS, [] {}, [&] {
+            for (PoseBuffer& pose : poses) pose.Compute(skeleton);
+        });
+
+        size_t mismatches = 0;
+        for (uint32_t c = 0; c < CHARACTERS; c++) {
+            if (memcmp(poses[c].GetSkinData(), naive[c].skin.data(), BONES * FPM * sizeof(float)) != 0) {
+                mismatches++;
+            }
+        }
+        totalMismatches += mismatches;
+        std::cout << "  아레나 PoseBuffer " << GetSimdLevelName(level) << " : " << ms << " ms/프레임 ("
+                  << naiveMs / ms << "x), 기준과 다른 캐릭터 " << mismatches << "명\n";
+    }
+    SetSimdLevel(supported);
+
+    // 4) 잘못된 뼈대는 커널에 넘기지 않고 거부 (범위 밖 읽기 방지)
+    Skeleton forwardParent = skeleton;
+    forwardParent.parents[10] = 50;                         // 부모가 자식보다 뒤
+    Skeleton outOfRange = skeleton;
+    outOfRange.parents[10] = (int32_t)BONES + 1000;         // 본 수 밖
+    Skeleton shortBind = skeleton;
+    shortBind.inverseBind.resize((BONES - 1) * FPM);        // 역바인드 행렬 하나 모자람
+    bool rejected = !poses[0].Compute(forwardParent) && !poses[0].Compute(outOfRange) &&
+                    !poses[0].Compute(shortBind);
+    std::cout << "  잘못된 뼈대 (부모가 뒤 / 부모가 범위 밖 / 역바인드 부족) 거부? " << rejected << "\n";
+
+    std::cout << "\n  [결과] " << (totalMismatches != 0 ? "결과 불일치! "
+                                : !rejected          ? "잘못된 뼈대를 받아들임! "
+                                                     : "모든 단계가 같은 팔레트를 만들고, ")
+              << "포즈는 한 블록에 연속으로 놓여 범위 밖 쓰기가 없습니다.\n";
+}
+
+// ============================================================================
+// G: 컴파일 시간 검사 + 할당 없는 FixedFormat
+// ============================================================================
+void BenchmarkFixedFormat() {
+    std::cout << "\n[G] 컴파일 시간 검사 + 할당 없는 FixedFormat\n";
+    std::cout << "  형식 문자열은 컴파일 시간에 검사하고, 고정 크기 스택 버퍼에만 안전하게 씁니다.\n";
+    std::cout << "  (Debug 빌드에서는 수치가 크게 왜곡되므로 Release에서 측정하세요)\n\n";
+
+    // 1) BUG D와 비교: 포인터 산술 대신 포맷
+    int boneIndex = 5;
+    FixedString<64> msg = Format<64>(FIXED_FMT("Bone index: {}"), boneIndex);
+    std::cout << "  BUG D → \"" << msg.c_str() << "\"\n";
+    msg.Clear();
+    msg.Append(FIXED_FMT("Bone index {} not Found"), 100);
+    std::cout << "          \"" << msg.c_str() << "\"\n";
+    // Format<64>(FIXED_FMT("Bone index: {} {}"), boneIndex);   → 컴파일 오류 (인자 수 불일치)
+    // Format<64>(FIXED_FMT("Weight: {:x}"), 0.5f);              → 컴파일 오류 (실수에 16진수)
+
+    // 2) BUG E와 비교: 32바이트 버퍼에 긴 메시지 → 잘라내고 알려 줌
+    FixedString<32> prefix = Format<32>(FIXED_FMT("[ERROR] {}:"), "MyVeryLongFunction");
+    prefix.Append(FIXED_FMT(" {}"),
+        "This is a very long error message that contains lots of details "
+        "about what went wrong in the system.");
+    std::cout << "  BUG E → \"" << prefix.c_str() << "\" (" << prefix.Length() << "/"
+              << FixedString<32>::Capacity() << "자, 잘림? " << prefix.IsTruncated() << ")\n\n";
+
+    // 3) 벤치마크: 같은 메시지를 snprintf / ostringstream / FixedFormat으로
+    const int COUNT = 200000;
+    const int ROUNDS = 3;
+    const char* names[] = { "Spine", "LeftHand", "RightFoot", "Head" };
+    auto weightOf = [](int i) { return (float)(i % 400) * 0.25f - 50.0f; };
+    auto addressOf = [](int i) { return 0x7FF6A0000000ull + (unsigned long long)i * 0x40; };
+
+    size_t sink = 0;
+    double snprintfMs = MeasureBestMs(ROUNDS, [&] { sink = 0; }, [&] {
+        for (int i = 0; i < COUNT; i++) {
+            char buf[256];
+            int n = snprintf(buf, sizeof(buf), "[ERROR] %s: bone %d of %d not found (weight %.2f, addr 0x%llX)",
+                             names[i & 3], i, 100, weightOf(i), addressOf(i));
+            sink += (size_t)n;
+        }
+    });
+    size_t snprintfSink = sink;
+
+    double streamMs = MeasureBestMs(ROUNDS, [&] { sink = 0; }, [&] {
+        for (int i = 0; i < COUNT; i++) {
+            std::ostringstream oss;
+            oss << "[ERROR] " << names[i & 3] << ": bone " << i << " of " << 100
+                << " not found (weight " << std::fixed << std::setprecision(2) << weightOf(i)
+                << ", addr 0x" << std::hex << std::uppercase << addressOf(i) << ")";
+            sink += oss.str().size();
+        }
+    });
+
+    double fixedMs = MeasureBestMs(ROUNDS, [&] { sink = 0; }, [&] {
+        for (int i = 0; i < COUNT; i++) {
+            FixedString<256> text = Format<256>(
+                FIXED_FMT("[ERROR] {}: bone {} of {} not found (weight {:.2}, addr 0x{:X})"),
+                names[i & 3], i, 100, weightOf(i), addressOf(i));
+            sink += text.Length();
+        }
+    });
+
+    size_t mismatches = 0;
+    for (int i = 0; i < COUNT; i++) {
+        char expected[256];
+        snprintf(expected, sizeof(expected), "[ERROR] %s: bone %d of %d not found (weight %.2f, addr 0x%llX)",
+                 names[i & 3], i, 100, weightOf(i), addressOf(i));
+        char actual[256];
+        FormatTo(actual, FIXED_FMT("[ERROR] {}: bone {} of {} not found (weight {:.2}, addr 0x{:X})"),
+                 names[i & 3], i, 100, weightOf(i), addressOf(i));
+        if (strcmp(expected, actual) != 0) mismatches++;
+    }
+
+    std::cout << "  메시지 " << COUNT << "개 (\"[ERROR] ...: bone ... (weight %.2f, addr 0x%llX)\")\n";
+    std::cout << "    snprintf      : " << snprintfMs << " ms\n";
+    std::cout << "    ostringstream : " << streamMs << " ms\n";
+    std::cout << "    FixedFormat   : " << fixedMs << " ms (snprintf 대비 " << snprintfMs / fixedMs
+              << "x, ostringstream 대비 " << streamMs / fixedMs << "x)\n";
+    std::cout << "    snprintf 결과와 다른 메시지 " << mismatches << "개, 총 길이 "
+              << (sink == snprintfSink ? "동일" : "다름!") << "\n";
+
+    std::cout << "\n  [결과] 인자 실수는 컴파일 오류로, 버퍼 부족은 잘라내기로 처리되고 힙 할당이 없습니다.\n";
+}
+
+// ============================================================================
+// H: 루프 진입 시 한 번만 검사하는 CheckedSpan
+// ============================================================================
+void BenchmarkCheckedSpan() {
+    std::cout << "\n[H] 루프 진입 시 한 번만 검사하는 CheckedSpan\n";
+    std::cout << "  범위는 루프 전에 한 번 검사하고, 안쪽 루프는 원시 포인터로 돌립니다.\n";
+    std::cout << "  (Debug 빌드에서는 수치가 크게 왜곡되므로 Release에서 측정하세요)\n\n";
+    std::cout << "  현재 정책: " << GetCheckedSpanPolicyName() << "\n\n";
+
+    // 1) BUG A와 비교: 빈 벡터에서 첫 원소 → 빈 span, 루프는 0번
+    std::vector<float> vertices;
+    CheckedSpan<float> vertexSpan(vertices);
+    int visited = 0;
+    for (float& v : vertexSpan.First(1)) { v = 0.0f; visited++; }
+    std::cout << "  BUG A → First(1) 순회 " << visited << "번 (크래시 없음)\n";
+
+    // 2) BUG B와 비교: index == size()는 Subspan에서 걸러짐
+    std::vector<std::string> cameras = { "Main", "UI", "Debug" };
+    CheckedSpan<const std::string> cameraSpan(cameras);
+    for (size_t index = 0; index <= cameras.size(); index++) {
+        CheckedSpan<const std::string> selected = cameraSpan.Subspan(index, 1);
+        std::cout << "  BUG B → index " << index << ": "
+                  << (selected.IsEmpty() ? "(거부됨)" : selected.Unchecked(0).c_str()) << "\n";
+    }
+    std::cout << "  보고된 위반 " << GetBoundsViolationCount() << "건\n\n";
+
+    // 3) 벤치마크: position += velocity * dt
+    const size_t COUNT = 1 << 20;
+    const int REPEAT = 20;
+    const int ROUNDS = 5;
+    const float dt = 0.016f;
+    std::vector<float> velocities(COUNT);
+    for (size_t i = 0; i < COUNT; i++) velocities[i] = (float)(i % 97) * 0.5f - 24.0f;
+    std::vector<float> start(COUNT, 1.0f);
+
+    std::vector<float> rawResult;
+    double rawMs = MeasureBestMs(ROUNDS, [&] { rawResult = start; }, [&] {
+        for (int r = 0; r < REPEAT; r++) {
+            float* p = rawResult.data();
+            const float* v = velocities.data();
+            for (size_t i = 0; i < COUNT; i++) p[i] += v[i] * dt;
+        }
+    });
+
+    std::vector<float> atResult;
+    double atMs = MeasureBestMs(ROUNDS, [&] { atResult = start; }, [&] {
+        for (int r = 0; r < REPEAT; r++) {
+            for (size_t i = 0; i < COUNT; i++) atResult.at(i) += velocities.at(i) * dt;
+        }
+    });
+
+    std::vector<float> indexResult;
+    double indexMs = MeasureBestMs(ROUNDS, [&] { indexResult = start; }, [&] {
+        for (int r = 0; r < REPEAT; r++) {
+            CheckedSpan<float> p(indexResult);
+            CheckedSpan<const float> v(velocities);
+            for (size_t i = 0; i < COUNT; i++) p[i] += v[i] * dt;
+        }
+    });
+
+    std::vector<float> zipResult;
+    double zipMs = MeasureBestMs(ROUNDS, [&] { zipResult = start; }, [&] {
+        for (int r = 0; r < REPEAT; r++) {
+            for (auto [p, v] : Zip(CheckedSpan<float>(zipResult), CheckedSpan<const float>(velocities))) {
+                p += v * dt;
+            }
+        }
+    });
+
+    bool same = atResult == rawResult && indexResult == rawResult && zipResult == rawResult;
+    std::cout << "  원소 " << COUNT << "개 x " << REPEAT << "회\n";
+    std::cout << "    원시 포인터            : " << rawMs << " ms\n";
+    std::cout << "    vector::at()           : " << atMs << " ms (" << atMs / rawMs << "배 시간)\n";
+    std::cout << "    CheckedSpan[] (매번)   : " << indexMs << " ms (" << indexMs / rawMs << "배 시간)\n";
+    std::cout << "    Zip(CheckedSpan) (한 번): " << zipMs << " ms (" << zipMs / rawMs << "배 시간), 결과 "
+              << (same ? "모두 동일" : "다름!") << "\n";
+
+    std::cout << "\n  [결과] 범위 검사를 루프 밖으로 올리면 원시 포인터 루프와 같은 비용으로 안전합니다.\n";
+}
+
+// ============================================================================
+// I: SIMD UTF-8 ↔ UTF-16/32 변환 + 파일명 금지 문자 치환
+// ============================================================================
+// 비교용: 12번 MakeSafeFilename과 같은 글자 단위 루프
+template <typename Unit>
+size_t NaiveSafeFilename(Unit* dst, size_t dstSize, const Unit* src, size_t srcLength) {
+    size_t i = 0;
+    for (; i < dstSize - 1 && i < srcLength; ++i) {
+        Unit c = src[i];
+        if (c == '/' || c == '\\' || c == ':' || c == '*' ||
+            c == '?' || c == '"'  || c == '<' || c == '>' || c == '|')
+            dst[i] = '_';
+        else
+            dst[i] = c;
+    }
+    dst[i] = 0;
+    return i;
+}
+
+void BenchmarkUtf8Transcode() {
+    std::cout << "\n[I] SIMD UTF-8 <-> UTF-16/32 변환 + 파일명 금지 문자 치환\n";
+    std::cout << "  ASCII 구간은 16/32글자씩 넓히고 좁히며, 금지 문자는 니블 표로 한 번에 분류합니다.\n";
+    std::cout << "  (Debug 빌드에서는 수치가 크게 왜곡되므로 Release에서 측정하세요)\n\n";
+
+    // 1) BUG E와 비교: 32글자 버퍼에 긴 메시지 → 코드 포인트 경계에서 멈추고 알려 줌
+    {
+        const char* message = u8"[ERROR] 텍스처 로드 실패: D:/Assets/Characters/Warrior/armor_diffuse.dds";
+        char16_t small[32];
+        TranscodeResult r = Utf8Transcode::Utf8ToUtf16(message, strlen(message), small, 32);
+        std::cout << "  BUG E → 입력 " << strlen(message) << "바이트 중 " << r.read << "바이트 변환, "
+                  << r.written << "/32글자, truncated = " << r.truncated << "\n";
+
+        // 잘못된 입력: 긴 인코딩 '/', 잘린 3바이트, 짝 없는 서로게이트
+        const char bad[] = "a\xC0\xAF" "b\xE2\x82" "c\xED\xA0\x80";
+        char32_t wide[16];
+        r = Utf8Transcode::Utf8ToUtf32(bad, sizeof(bad) - 1, wide, 16);
+        std::cout << "  잘못된 UTF-8 " << sizeof(bad) - 1 << "바이트 → " << r.written << "글자, U+FFFD 치환 "
+                  << r.replaced << "건\n";
+
+        char safe[32];
+        SafeFilename::Copy(safe, sizeof(safe), "feature/crash:dump?v=2");
+        std::cout << "  \"feature/crash:dump?v=2\" → \"" << safe << "\"\n\n";
+    }
+
+    // 2) 경로 데이터: 대부분 ASCII, 일부에 한글 폴더
+    const size_t PATHS = 200000;
+    const int REPEAT = 5;
+    const int ROUNDS = 3;
+    SimdLevel supported = GetSupportedSimdLevel();
+
+    std::mt19937 rng(11);
+    const char* roots[] = { "D:/Builds/release-1.4", "C:\\Users\\dev\\AppData\\Local\\Game", "feature/render-graph" };
+    const char* folders[] = { "Characters/Warrior", "Textures", u8"맵/던전_03", "Audio/Voice:KR", "Shaders?debug" };
+    std::vector<std::string> paths(PATHS);
+    size_t totalBytes = 0;
+    for (size_t i = 0; i < PATHS; i++) {
+        std::ostringstream os;
+        os << roots[rng() % 3] << "/" << folders[rng() % 5] << "/asset_" << std::setw(6) << std::setfill('0')
+           << (rng() % 1000000) << (rng() % 2 ? ".dds" : "<lod1>.mesh");
+        paths[i] = os.str();
+        totalBytes += paths[i].size();
+    }
+    std::cout << "  경로 " << PATHS << "개 (평균 " << totalBytes / PATHS << "바이트) x " << REPEAT
+              << "회, CPU 지원 단계: " << GetSimdLevelName(supported) << "\n\n";
+
+    // UTF-16 글자 수는 UTF-8 바이트 수를 넘지 않으므로 경로마다 그 크기만큼 자리를 잡음
+    std::vector<size_t> offsets(PATHS + 1, 0);
+    for (size_t i = 0; i < PATHS; i++) offsets[i + 1] = offsets[i] + paths[i].size();
+    std::vector<char16_t> utf16(totalBytes);
+    std::vector<size_t> utf16Length(PATHS);
+    std::vector<char> utf8Back(totalBytes);
+    std::vector<char> safe8(totalBytes + PATHS);
+    std::vector<char16_t> safe16(totalBytes + PATHS);
+
+    // 기준: Scalar 단계 변환 결과와 글자 단위 금지 문자 루프
+    SetSimdLevel(SimdLevel::Scalar);
+    for (size_t i = 0; i < PATHS; i++) {
+        utf16Length[i] = Utf8Transcode::Utf8ToUtf16(paths[i].data(), paths[i].size(),
+                                                    &utf16[offsets[i]], paths[i].size()).written;
+    }
+    std::vector<char16_t> expected16 = utf16;
+    std::vector<char> expectedSafe8(safe8.size());
+    std::vector<char16_t> expectedSafe16(safe16.size());
+    double naive8Ms = MeasureBestMs(ROUNDS, [] {}, [&] {
+        for (int r = 0; r < REPEAT; r++) {
+            for (size_t i = 0; i < PATHS; i++) {
+                NaiveSafeFilename(&expectedSafe8[offsets[i] + i], paths[i].size() + 1, paths[i].c_str(), paths[i].size());
+            }
+        }
+    });
+    double naive16Ms = MeasureBestMs(ROUNDS, [] {}, [&] {
+        for (int r = 0; r < REPEAT; r++) {
+            for (size_t i = 0; i < PATHS; i++) {
+                NaiveSafeFilename(&expectedSafe16[offsets[i] + i], utf16Length[i] + 1, &utf16[offsets[i]], utf16Length[i]);
+            }
+        }
+    });
+    std::cout << "  글자 단위 금지 문자 치환  UTF-8: " << naive8Ms << " ms, UTF-16: " << naive16Ms << " ms\n";
+
+    // 3) 단계별: UTF-8 → UTF-16 → UTF-8 왕복, 금지 문자 치환
+    const SimdLevel levels[] = { SimdLevel::Scalar, SimdLevel::SSE41, SimdLevel::AVX2 };
+    double scalarDecodeMs = 0.0;
+    size_t totalMismatches = 0;
+    for (SimdLevel level : levels) {
+        if (level > supported) continue;
+        SetSimdLevel(level);
+
+        double decodeMs = MeasureBestMs(ROUNDS, [] {}, [&] {
+            for (int r = 0; r < REPEAT; r++) {
+                for (size_t i = 0; i < PATHS; i++) {
+                    Utf8Transcode::Utf8ToUtf16(paths[i].data(), paths[i].size(), &utf16[offsets[i]], paths[i].size());
+                }
+            }
+        });
+        double encodeMs = MeasureBestMs(ROUNDS, [] {}, [&] {
+            for (int r = 0; r < REPEAT; r++) {
+                for (size_t i = 0; i < PATHS; i++) {
+                    Utf8Transcode::Utf16ToUtf8(&utf16[offsets[i]], utf16Length[i], &utf8Back[offsets[i]], paths[i].size());
+                }
+            }
+        });
+        double safe8Ms = MeasureBestMs(ROUNDS, [] {}, [&] {
+            for (int r = 0; r < REPEAT; r++) {
+                for (size_t i = 0; i < PATHS; i++) {
+                    SafeFilename::Copy(&safe8[offsets[i] + i], paths[i].size() + 1, paths[i].c_str());
+                }
+            }
+        });
+        double safe16Ms = MeasureBestMs(ROUNDS, [] {}, [&] {
+            for (int r = 0; r < REPEAT; r++) {
+                for (size_t i = 0; i < PATHS; i++) {
+                    SafeFilename::Replace(&safe16[offsets[i] + i], &utf16[offsets[i]], utf16Length[i]);
+                }
+            }
+        });
+        if (level == SimdLevel::Scalar) scalarDecodeMs = decodeMs;
+
+        size_t mismatches = 0;
+        for (size_t i = 0; i < PATHS; i++) {
+            size_t n = utf16Length[i];
+            if (memcmp(&utf16[offsets[i]], &expected16[offsets[i]], n * sizeof(char16_t)) != 0 ||
+                memcmp(&utf8Back[offsets[i]], paths[i].data(), paths[i].size()) != 0 ||
+                memcmp(&safe8[offsets[i] + i], &expectedSafe8[offsets[i] + i], paths[i].size() + 1) != 0 ||
+                memcmp(&safe16[offsets[i] + i], &expectedSafe16[offsets[i] + i], n * sizeof(char16_t)) != 0) {
+                mismatches++;
+            }
+        }
+        totalMismatches += mismatches;
+        std::cout << "  " << GetSimdLevelName(level) << "\n";
+        std::cout << "    UTF-8 → UTF-16 : " << decodeMs << " ms (Scalar 대비 " << scalarDecodeMs / decodeMs << "x)\n";
+        std::cout << "    UTF-16 → UTF-8 : " << encodeMs << " ms\n";
+        std::cout << "    금지 문자 치환 : UTF-8 " << safe8Ms << " ms (" << naive8Ms / safe8Ms << "x), UTF-16 "
+                  << safe16Ms << " ms (" << naive16Ms / safe16Ms << "x), 기준과 다른 경로 " << mismatches << "개\n";
+    }
+    SetSimdLevel(supported);
+
+    std::cout << "\n  [결과] " << (totalMismatches == 0 ? "모든 단계가 같은 결과를 내고, " : "결과 불일치! ")
+              << "출력은 항상 버퍼 크기 안에서 코드 포인트 경계로 끝납니다.\n";
+}
+
 // ============================================================================
 // 메인
 // ============================================================================
@@ -150,6 +644,10 @@ int main() {
     std::cout << "  [C] 고정 크기 배열 오버플로\n";
     std::cout << "  [D] 문자열 + 정수 = 포인터 산술\n";
     std::cout << "  [E] 고정 크기 문자열 버퍼 오버플로\n";
+    std::cout << "  [F] 정렬 아레나 PoseBuffer + SIMD 4x4 행렬 팔레트 커널\n";
+    std::cout << "  [G] 컴파일 시간 검사 + 할당 없는 FixedFormat\n";
+    std::cout << "  [H] 루프 진입 시 한 번만 검사하는 CheckedSpan\n";
+    std::cout << "  [I] SIMD UTF-8 <-> UTF-16/32 변환 + 파일명 금지 문자 치환\n";
     std::cout << "  [Q] 종료\n";
     std::cout << "----------------------------------------------------\n";
 
@@ -165,6 +663,10 @@ int main() {
         case 'C': BugC_FixedArrayOverflow(); break;
         case 'D': BugD_StringPlusInt(); break;
         case 'E': BugE_WcharBufferOverflow(); break;
+        case 'F': BenchmarkPoseBuffer(); break;
+        case 'G': BenchmarkFixedFormat(); break;
+        case 'H': BenchmarkCheckedSpan(); break;
+        case 'I': BenchmarkUtf8Transcode(); break;
         case 'Q': std::cout << "종료합니다.\n"; return 0;
         default:  std::cout << "잘못된 입력입니다.\n"; break;
         }
@@ -0,0 +1,134 @@
+/*============================================================================
+ *  AsyncLogger.cpp - 출력 스레드: 링 비우기, FixedFormat으로 포맷, 묶어서 fwrite
+ *============================================================================*/
+#include "AsyncLogger.h"
+
+#include <chrono>
+
+namespace {
+
+constexpr size_t kBufferSize = 64 * 1024;
+constexpr size_t kMaxLineSize = 512;        // 한 줄 최대 길이 (넘치면 잘림)
+constexpr size_t kBatchSize = 256;          // 링에서 한 번에 꺼내는 레코드 수
+constexpr auto   kIdleWait = std::chrono::milliseconds(1);
+
+} // namespace
+
+AsyncLogger::AsyncLogger(std::FILE* output, size_t ringCapacity, size_t laneCount)
+    : m_Output(output),
+      m_RingCapacity(ringCapacity),
+      m_LaneCount(laneCount),
+      m_Lanes(new std::atomic<SpscRing<LogRecord>*>[laneCount]),
+      m_Buffer(kBufferSize) {
+    for (size_t i = 0; i < laneCount; i++) m_Lanes[i].store(nullptr, std::memory_order_relaxed);
+    m_Writer = std::thread(&AsyncLogger::WriterMain, this);
+}
+
+AsyncLogger::~AsyncLogger() {
+    {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Running.store(false, std::memory_order_release);
+    }
+    m_WakeCondition.notify_one();
+    m_Writer.join();
+
+    for (size_t i = 0; i < m_LaneCount; i++) delete m_Lanes[i].load(std::memory_order_relaxed);
+}
+
+// 이 스레드 번호의 링. 처음이면 만듦 (같은 번호를 동시에 가진 스레드는 없음)
+SpscRing<LogRecord>* AsyncLogger::GetThreadRing() {
+    size_t index = GetThreadIndex();
+    if (index >= m_LaneCount) {
+        m_LaneDropped.fetch_add(1, std::memory_order_relaxed);
+        return nullptr;
+    }
+    SpscRing<LogRecord>* ring = m_Lanes[index].load(std::memory_order_acquire);
+    if (!ring) {
+        ring = new SpscRing<LogRecord>(m_RingCapacity);
+        m_Lanes[index].store(ring, std::memory_order_release);
+    }
+    return ring;
+}
+
+void AsyncLogger::Flush() {
+    uint64_t target = m_FlushRequested.fetch_add(1, std::memory_order_acq_rel) + 1;
+    std::unique_lock<std::mutex> lock(m_Mutex);
+    m_WakeCondition.notify_one();
+    m_FlushCondition.wait(lock, [&] { return m_FlushCompleted >= target; });
+}
+
+uint64_t AsyncLogger::GetDroppedCount() const {
+    uint64_t dropped = m_LaneDropped.load(std::memory_order_relaxed);
+    for (size_t i = 0; i < m_LaneCount; i++) {
+        if (SpscRing<LogRecord>* ring = m_Lanes[i].load(std::memory_order_acquire)) dropped += ring->GetDroppedCount();
+    }
+    return dropped;
+}
+
+size_t AsyncLogger::FormatRecord(const LogRecord& record, char* out, size_t capacity) {
+    if (capacity < 2) return 0;
+    FormatBuffer buffer(out, capacity);     // 끝의 '\0' 자리를 '\n'으로 바꿔 씀
+    FormatTo(buffer, FIXED_FMT("[T{}] "), record.threadIndex);
+    record.format(record, buffer);
+    size_t used = buffer.Length();
+    out[used++] = '\n';
+    return used;
+}
+
+void AsyncLogger::WriteBuffer() {
+    if (m_BufferUsed == 0) return;
+    std::fwrite(m_Buffer.data(), 1, m_BufferUsed, m_Output);
+    std::fflush(m_Output);
+    m_BufferUsed = 0;
+    m_WriteCount.fetch_add(1, std::memory_order_relaxed);
+}
+
+// 모든 링을 빌 때까지 돌며 포맷. 버퍼가 차면 그때 씀. 처리한 레코드 수를 돌려줌
+size_t AsyncLogger::DrainRings() {
+    LogRecord batch[kBatchSize];
+    size_t total = 0;
+    for (;;) {
+        size_t round = 0;
+        for (size_t lane = 0; lane < m_LaneCount; lane++) {
+            SpscRing<LogRecord>* ring = m_Lanes[lane].load(std::memory_order_acquire);
+            if (!ring) continue;
+            size_t count = ring->PopBatch(batch, kBatchSize);
+            for (size_t i = 0; i < count; i++) {
+                if (m_Buffer.size() - m_BufferUsed < kMaxLineSize) WriteBuffer();
+                m_BufferUsed += FormatRecord(batch[i], m_Buffer.data() + m_BufferUsed, kMaxLineSize);
+            }
+            round += count;
+        }
+        if (round == 0) break;
+        total += round;
+    }
+    m_RecordCount.fetch_add(total, std::memory_order_relaxed);
+    return total;
+}
+
+void AsyncLogger::WriterMain() {
+    for (;;) {
+        // 비우기 전에 읽어야, 요청 전에 들어온 로그가 이번에 함께 나감
+        bool running = m_Running.load(std::memory_order_acquire);
+        uint64_t flushRequest = m_FlushRequested.load(std::memory_order_acquire);
+
+        size_t drained = DrainRings();
+        WriteBuffer();
+
+        {
+            std::unique_lock<std::mutex> lock(m_Mutex);
+            if (m_FlushCompleted < flushRequest) {
+                m_FlushCompleted = flushRequest;
+                m_FlushCondition.notify_all();
+            }
+            if (!running) break;
+            // 생산자는 깨우지 않으므로 (Log를 싸게 하려고) 짧게 자고 다시 확인
+            if (drained == 0) {
+                m_WakeCondition.wait_for(lock, kIdleWait, [&] {
+                    return m_FlushRequested.load(std::memory_order_acquire) != flushRequest ||
+                           !m_Running.load(std::memory_order_acquire);
+                });
+            }
+        }
+    }
+}
@@ -0,0 +1,201 @@
+/*============================================================================
+ *  AsyncLogger - 스레드별 SPSC 링 + 백그라운드 포맷/출력 스레드
+ *  ---------------------------------------------------------------------------
+ *  BUG A의 워커는 줄마다 ostringstream으로 문자열을 만들고 std::cout에 씁니다.
+ *  std::cout은 전역 락을 잡고, 콘솔에서는 줄마다 시스템 호출(write)을 합니다.
+ *  로그 한 줄 때문에 게임 스레드가 수 마이크로초씩 멈추고, 스레드끼리 락을 기다립니다.
+ *
+ *  AsyncLogger는 호출한 스레드에서 문자열을 만들지 않습니다.
+ *      Log()        : 포맷 ID와 인자 값만 LogRecord에 담아 자기 스레드의 SpscRing에 넣음
+ *                     (락/할당/시스템 호출 없음)
+ *      출력 스레드  : 모든 링에서 묶음으로 꺼내 포맷하고, 64KB 버퍼가 차거나
+ *                     링이 비면 fwrite 한 번으로 내보냄
+ *
+ *  [포맷]
+ *      logger.Log(FIXED_FMT("Thread {}: Failure with HRESULT of {:X}"), threadId, hr);
+ *  형식 문자열은 Common/FixedFormat과 같습니다 ({} {:x} {:X} {:.N} {{ }}).
+ *  컴파일 시간에 해석하므로 {} 개수와 인자 수가 다르거나 형식이 맞지 않으면 컴파일 오류이고,
+ *  출력도 FixedFormat과 글자 하나까지 같습니다 (실수 {}는 소수점 6자리, 폭/0 채우기는 없음).
+ *  포맷 ID는 (형식 문자열, 인자 형식) 조합마다 하나씩 만들어지는 함수 포인터로,
+ *  출력 스레드가 이 함수로 인자를 원래 형식으로 되돌려 FormatTo를 부릅니다.
+ *  각 줄 앞에는 "[T<스레드 번호>] "가 붙습니다.
+ *
+ *  [제한]
+ *  - const char* 인자는 프로그램 끝까지 살아 있어야 합니다 (문자열 리터럴).
+ *    포인터만 저장하고 출력 스레드가 나중에 읽기 때문입니다. std::string은 받지 않습니다.
+ *  - 인자는 최대 LogRecord::kMaxArgs개 (컴파일 시간 검사).
+ *  - 링이 꽉 차면 기다리지 않고 버리고 DroppedCount를 올립니다.
+ *  - 순서는 스레드 안에서만 보장됩니다. 다른 스레드의 줄과는 섞일 수 있습니다.
+ *  - 링(레인)은 GetThreadIndex()로 고릅니다. 레인 수 이상의 번호를 가진 스레드의 로그는 버립니다.
+ *============================================================================*/
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "FixedFormat.h"
+#include "SpscRing.h"
+#include "ThreadIndex.h"
+
+union LogArgValue {
+    int64_t     i;
+    uint64_t    u;
+    double      d;
+    const char* s;
+    const void* p;
+};
+
+struct LogRecord;
+
+// 포맷 ID: record의 인자를 원래 형식으로 되돌려 out에 포맷
+using LogFormatFn = void (*)(const LogRecord& record, FormatBuffer& out);
+
+// 호출한 스레드가 링에 넣는 이진 레코드 (64바이트)
+struct LogRecord {
+    static constexpr size_t kMaxArgs = 6;
+
+    LogFormatFn format;
+    uint32_t    threadIndex;
+    LogArgValue args[kMaxArgs];
+};
+
+namespace AsyncLoggerDetail {
+
+// 링에 담는 형식. 열거형은 정수로, 문자열은 const char*로, 그 밖의 포인터는 const void*로
+template <typename T, typename = void>
+struct Stored {
+    using Type = T;
+};
+template <typename T>
+struct Stored<T, std::enable_if_t<std::is_enum_v<T>>> {
+    using Type = std::underlying_type_t<T>;
+};
+template <typename T>
+struct Stored<T*, void> {
+    using Type = std::conditional_t<std::is_same_v<std::remove_cv_t<T>, char>, const char*, const void*>;
+};
+
+template <typename T>
+using StoredType = typename Stored<std::decay_t<T>>::Type;
+
+template <typename T>
+LogArgValue Encode(const T& value) {
+    LogArgValue arg;
+    if constexpr (std::is_floating_point_v<T>) {
+        arg.d = (double)value;
+    } else if constexpr (std::is_integral_v<T> && std::is_signed_v<T>) {
+        arg.i = (int64_t)value;
+    } else if constexpr (std::is_integral_v<T>) {
+        arg.u = (uint64_t)value;
+    } else if constexpr (std::is_same_v<T, const char*>) {
+        arg.s = value;
+    } else if constexpr (std::is_same_v<T, const void*>) {
+        arg.p = value;
+    } else {
+        static_assert(FixedFormatDetail::AlwaysFalse<T>::value,
+                      "로그 인자는 정수/실수/bool/문자열 리터럴/포인터만 됩니다 (std::string은 c_str()도 안 됨)");
+    }
+    return arg;
+}
+
+template <typename T>
+T Decode(const LogArgValue& arg) {
+    if constexpr (std::is_floating_point_v<T>) return (T)arg.d;
+    else if constexpr (std::is_integral_v<T> && std::is_signed_v<T>) return (T)arg.i;
+    else if constexpr (std::is_integral_v<T>) return (T)arg.u;
+    else if constexpr (std::is_same_v<T, const char*>) return arg.s;
+    else return arg.p;
+}
+
+template <typename Fmt, typename... Args, size_t... I>
+void FormatArgs(const LogRecord& record, FormatBuffer& out, std::index_sequence<I...>) {
+    FormatTo(out, Fmt{}, Decode<Args>(record.args[I])...);
+}
+
+// (형식 문자열, 인자 형식) 조합마다 하나씩 생기는 포맷 ID
+template <typename Fmt, typename... Args>
+void FormatRecordArgs(const LogRecord& record, FormatBuffer& out) {
+    FormatArgs<Fmt, Args...>(record, out, std::index_sequence_for<Args...>());
+}
+
+} // namespace AsyncLoggerDetail
+
+class AsyncLogger {
+public:
+    static constexpr size_t kDefaultRingCapacity = 4096;   // 스레드당 레코드 수
+    static constexpr size_t kDefaultLaneCount = 64;
+
+    // output은 로거보다 오래 살아 있어야 함 (닫지 않음)
+    explicit AsyncLogger(std::FILE* output, size_t ringCapacity = kDefaultRingCapacity,
+                         size_t laneCount = kDefaultLaneCount);
+    ~AsyncLogger();     // 남은 로그를 모두 쓰고 출력 스레드를 멈춤
+
+    AsyncLogger(const AsyncLogger&) = delete;
+    AsyncLogger& operator=(const AsyncLogger&) = delete;
+
+    // 호출한 스레드의 링에 넣기만 함. 버렸으면 false. format은 FIXED_FMT("...")
+    template <typename Fmt, typename... Args>
+    bool Log(Fmt, const Args&... args) {
+        static_assert(sizeof...(Args) <= LogRecord::kMaxArgs, "로그 인자가 너무 많습니다 (LogRecord::kMaxArgs)");
+        static_assert(FixedFormatDetail::Parsed<Fmt>::value.argCount == (int)sizeof...(Args),
+                      "형식 문자열의 {} 개수와 인자 수가 다릅니다");
+
+        SpscRing<LogRecord>* ring = GetThreadRing();
+        if (!ring) return false;
+
+        LogRecord record;
+        record.format = &AsyncLoggerDetail::FormatRecordArgs<Fmt, AsyncLoggerDetail::StoredType<Args>...>;
+        record.threadIndex = (uint32_t)GetThreadIndex();
+        size_t index = 0;
+        ((record.args[index++] = AsyncLoggerDetail::Encode<AsyncLoggerDetail::StoredType<Args>>(
+              (AsyncLoggerDetail::StoredType<Args>)args)),
+         ...);
+        (void)index;
+        return ring->TryPush(record);
+    }
+
+    // 이 호출 전에 (어느 스레드에서든) 넣은 로그가 모두 출력될 때까지 기다림
+    void Flush();
+
+    uint64_t GetDroppedCount() const;
+    uint64_t GetWriteCount() const { return m_WriteCount.load(std::memory_order_relaxed); }      // fwrite 호출 수
+    uint64_t GetRecordCount() const { return m_RecordCount.load(std::memory_order_relaxed); }    // 출력한 줄 수
+
+    // record 한 줄을 out에 포맷 (끝에 '\n', 넘치면 잘림). 쓴 바이트 수를 돌려줌
+    static size_t FormatRecord(const LogRecord& record, char* out, size_t capacity);
+
+private:
+    SpscRing<LogRecord>* GetThreadRing();
+    void WriterMain();
+    size_t DrainRings();
+    void WriteBuffer();
+
+    std::FILE*                                          m_Output;
+    size_t                                              m_RingCapacity;
+    size_t                                              m_LaneCount;
+    std::unique_ptr<std::atomic<SpscRing<LogRecord>*>[]> m_Lanes;  // 처음 로그를 남길 때 그 스레드가 만듦
+    std::atomic<uint64_t>                               m_LaneDropped{ 0 };
+
+    // 출력 스레드 전용
+    std::vector<char>                                   m_Buffer;
+    size_t                                              m_BufferUsed = 0;
+    std::atomic<uint64_t>                               m_WriteCount{ 0 };
+    std::atomic<uint64_t>                               m_RecordCount{ 0 };
+
+    std::mutex                                          m_Mutex;
+    std::condition_variable                             m_WakeCondition;     // 출력 스레드 깨우기 (Flush/종료)
+    std::condition_variable                             m_FlushCondition;    // Flush 완료 알림
+    std::atomic<uint64_t>                               m_FlushRequested{ 0 };
+    uint64_t                                            m_FlushCompleted = 0;  // m_Mutex
+    std::atomic<bool>                                   m_Running{ true };
+    std::thread                                         m_Writer;
+};
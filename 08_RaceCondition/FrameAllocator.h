@@ -0,0 +1,164 @@
+/*============================================================================
+ *  FrameAllocator - 프레임 단위 선형(bump) 스크래치 할당자
+ *  ---------------------------------------------------------------------------
+ *  매 프레임 만들어졌다 버려지는 임시 문자열/벡터를 힙 대신
+ *  미리 잡아둔 버퍼에서 포인터만 전진시켜 할당합니다.
+ *  개별 해제는 없고, 프레임이 끝나면 버퍼 전체를 한 번에 리셋합니다.
+ *
+ *  [이중 버퍼]
+ *  버퍼 2개를 번갈아 사용하므로 프레임 N에서 할당한 메모리는
+ *  프레임 N+1이 끝날 때까지 유효합니다. (다음 프레임에서 읽는 용도)
+ *
+ *      프레임 N   : buffer[0]에 할당
+ *      EndFrame() : buffer[1]로 전환 후 리셋 (buffer[0]은 그대로 유지)
+ *      프레임 N+1 : buffer[1]에 할당, 프레임 N 데이터 읽기 가능
+ *      EndFrame() : buffer[0]으로 전환 후 리셋 → 프레임 N 데이터 소멸
+ *
+ *  [표준 컨테이너와 함께 사용]
+ *      FrameAllocator frame(64 * 1024);
+ *      FrameMemoryResource resource(frame);
+ *      std::pmr::string msg(&resource);   // 힙 할당 없음
+ *
+ *  [주의] 스레드 안전하지 않습니다. 스레드마다 하나씩 두세요.
+ *  버퍼가 부족하면 upstream(기본: new/delete)에서 할당하고 OverflowCount가 증가합니다.
+ *============================================================================*/
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <vector>
+
+class FrameAllocator {
+public:
+    // 프레임 번호로 수명을 표시한 포인터
+    template <typename T>
+    struct Tagged {
+        T*       ptr = nullptr;
+        uint64_t frame = 0;
+    };
+
+    explicit FrameAllocator(size_t bytesPerBuffer,
+                            std::pmr::memory_resource* upstream = std::pmr::new_delete_resource())
+        : m_Capacity(bytesPerBuffer), m_Upstream(upstream) {
+        for (Buffer& buffer : m_Buffers) {
+            buffer.base = static_cast<unsigned char*>(upstream->allocate(bytesPerBuffer, alignof(std::max_align_t)));
+        }
+    }
+
+    ~FrameAllocator() {
+        for (Buffer& buffer : m_Buffers) {
+            ReleaseOverflow(buffer);
+            m_Upstream->deallocate(buffer.base, m_Capacity, alignof(std::max_align_t));
+        }
+    }
+
+    FrameAllocator(const FrameAllocator&) = delete;
+    FrameAllocator& operator=(const FrameAllocator&) = delete;
+
+    // alignment는 2의 거듭제곱. 버퍼 시작 주소는 max_align_t까지만 정렬되어 있으므로
+    // 오프셋이 아니라 실제 주소(base + used)를 정렬함 (__m128, alignas(32) 타입 등)
+    void* Allocate(size_t size, size_t alignment = alignof(std::max_align_t)) {
+        assert(alignment != 0 && (alignment & (alignment - 1)) == 0 && "alignment는 2의 거듭제곱이어야 합니다");
+        Buffer& buffer = m_Buffers[m_Current];
+        uintptr_t address = reinterpret_cast<uintptr_t>(buffer.base) + buffer.used;
+        size_t padding = (size_t)((alignment - (address & (alignment - 1))) & (alignment - 1));
+        if (padding <= m_Capacity - buffer.used && size <= m_Capacity - buffer.used - padding) {
+            size_t offset = buffer.used + padding;
+            buffer.used = offset + size;
+            return buffer.base + offset;
+        }
+
+        // 버퍼 초과: upstream에서 할당하고 프레임 리셋 때 함께 해제
+        void* p = m_Upstream->allocate(size, alignment);
+        buffer.overflow.push_back({ p, size, alignment });
+        m_OverflowCount++;
+        return p;
+    }
+
+    template <typename T>
+    Tagged<T> AllocateTagged(size_t count = 1) {
+        Tagged<T> tagged;
+        tagged.ptr = static_cast<T*>(Allocate(sizeof(T) * count, alignof(T)));
+        tagged.frame = m_Frame;
+        return tagged;
+    }
+
+    // 프레임 N의 할당은 프레임 N, N+1 동안 유효
+    bool IsAlive(uint64_t frame) const {
+        return frame <= m_Frame && m_Frame - frame <= 1;
+    }
+
+    template <typename T>
+    T* Resolve(const Tagged<T>& tagged) const {
+        assert(IsAlive(tagged.frame) && "이미 리셋된 프레임의 스크래치 메모리에 접근!");
+        return IsAlive(tagged.frame) ? tagged.ptr : nullptr;
+    }
+
+    // 프레임 종료: 다른 버퍼로 전환하고, 그 버퍼(두 프레임 전 데이터)를 리셋
+    void EndFrame() {
+        Buffer& current = m_Buffers[m_Current];
+        if (current.used > m_PeakUsage) m_PeakUsage = current.used;
+
+        m_Current ^= 1;
+        m_Frame++;
+
+        Buffer& next = m_Buffers[m_Current];
+        ReleaseOverflow(next);
+        next.used = 0;
+    }
+
+    uint64_t CurrentFrame() const  { return m_Frame; }
+    size_t   UsedBytes() const     { return m_Buffers[m_Current].used; }
+    size_t   PeakUsage() const     { return m_PeakUsage; }
+    size_t   Capacity() const      { return m_Capacity; }
+    uint64_t OverflowCount() const { return m_OverflowCount; }
+
+private:
+    struct OverflowBlock {
+        void*  ptr;
+        size_t size;
+        size_t alignment;
+    };
+
+    struct Buffer {
+        unsigned char*             base = nullptr;
+        size_t                     used = 0;
+        std::vector<OverflowBlock> overflow;
+    };
+
+    void ReleaseOverflow(Buffer& buffer) {
+        for (const OverflowBlock& block : buffer.overflow) {
+            m_Upstream->deallocate(block.ptr, block.size, block.alignment);
+        }
+        buffer.overflow.clear();
+    }
+
+    Buffer                     m_Buffers[2];
+    int                        m_Current = 0;
+    uint64_t                   m_Frame = 0;
+    size_t                     m_Capacity;
+    size_t                     m_PeakUsage = 0;
+    uint64_t                   m_OverflowCount = 0;
+    std::pmr::memory_resource* m_Upstream;
+};
+
+// std::pmr 컨테이너용 어댑터 - deallocate는 아무것도 하지 않음 (프레임 리셋 때 일괄 해제)
+class FrameMemoryResource : public std::pmr::memory_resource {
+public:
+    explicit FrameMemoryResource(FrameAllocator& allocator) : m_Allocator(allocator) {}
+
+private:
+    void* do_allocate(size_t bytes, size_t alignment) override {
+        return m_Allocator.Allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void*, size_t, size_t) override {}
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+
+    FrameAllocator& m_Allocator;
+};
@@ -0,0 +1,132 @@
+/*============================================================================
+ *  FrameAppendLog - 스레드별 추가 전용 블록, 프레임 끝에 한 번 합치기
+ *  ---------------------------------------------------------------------------
+ *  MpscRing은 값마다 tail CAS 한 번이 필요합니다. 로그를 프레임 안에서 모으고
+ *  프레임이 끝난 뒤에만 읽는다면 그 동기화조차 필요 없습니다.
+ *
+ *  스레드마다 고정 크기 블록 목록(Lane)을 두고 Append()는 자기 블록 끝에만 씁니다.
+ *      Append()      : 원자적 연산 없음. 블록이 차면 다음 블록으로 (재사용 목록에서)
+ *      MergeInto()   : 프레임 끝(모든 생산자가 멈춘 뒤)에 스레드 번호 순으로 이어 붙이고
+ *                      블록을 재사용 목록으로 돌려줌
+ *  블록은 프레임이 지나도 재사용되므로 정상 상태에서는 힙 할당이 없습니다.
+ *  레인은 GetThreadIndex()로 고르며, 레인 수 이상의 번호를 가진 스레드의 값은
+ *  기다리지 않고 버리고 DroppedCount를 올립니다.
+ *
+ *  [주의] MergeInto()/Clear()는 Append()와 동시에 호출하면 안 됩니다.
+ *  프레임 경계(스레드 join, 작업 완료 대기 등)에서 호출하세요.
+ *============================================================================*/
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "ThreadIndex.h"
+
+template <typename T, size_t BlockSize = 1024>
+class FrameAppendLog {
+public:
+    static constexpr size_t kCacheLineSize = 64;
+    static constexpr size_t kDefaultLaneCount = 64;
+
+    explicit FrameAppendLog(size_t laneCount = kDefaultLaneCount)
+        : m_Lanes(new Lane[laneCount]), m_LaneCount(laneCount) {}
+
+    ~FrameAppendLog() {
+        for (size_t i = 0; i < m_LaneCount; i++) {
+            FreeBlocks(m_Lanes[i].head);
+            FreeBlocks(m_Lanes[i].freeList);
+        }
+    }
+
+    FrameAppendLog(const FrameAppendLog&) = delete;
+    FrameAppendLog& operator=(const FrameAppendLog&) = delete;
+
+    // 생산자: 자기 레인에만 씀
+    bool Append(const T& value) {
+        size_t index = GetThreadIndex();
+        if (index >= m_LaneCount) {
+            m_Dropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        Lane& lane = m_Lanes[index];
+        Block* tail = lane.tail;
+        if (!tail || tail->count == BlockSize) tail = AppendBlock(lane);
+        tail->items[tail->count++] = value;
+        return true;
+    }
+
+    // 프레임 끝: 모든 레인을 레인 번호 순으로 out 뒤에 붙이고 비움. 붙인 개수를 돌려줌
+    size_t MergeInto(std::vector<T>& out) {
+        size_t total = 0;
+        for (size_t i = 0; i < m_LaneCount; i++) {
+            for (Block* block = m_Lanes[i].head; block; block = block->next) total += block->count;
+        }
+        out.reserve(out.size() + total);
+        for (size_t i = 0; i < m_LaneCount; i++) {
+            for (Block* block = m_Lanes[i].head; block; block = block->next) {
+                out.insert(out.end(), block->items, block->items + block->count);
+            }
+        }
+        Clear();
+        return total;
+    }
+
+    // 기록을 버리고 블록을 재사용 목록으로
+    void Clear() {
+        for (size_t i = 0; i < m_LaneCount; i++) {
+            Lane& lane = m_Lanes[i];
+            if (lane.tail) {
+                lane.tail->next = lane.freeList;
+                lane.freeList = lane.head;
+            }
+            lane.head = lane.tail = nullptr;
+        }
+    }
+
+    size_t GetLaneCount() const { return m_LaneCount; }
+    uint64_t GetDroppedCount() const { return m_Dropped.load(std::memory_order_relaxed); }
+
+private:
+    struct Block {
+        T      items[BlockSize];
+        size_t count = 0;
+        Block* next = nullptr;
+    };
+
+    // 레인끼리 캐시 라인을 공유하지 않게
+    struct alignas(kCacheLineSize) Lane {
+        Block* head = nullptr;
+        Block* tail = nullptr;
+        Block* freeList = nullptr;
+    };
+
+    Block* AppendBlock(Lane& lane) {
+        Block* block = lane.freeList;
+        if (block) {
+            lane.freeList = block->next;
+            block->count = 0;
+            block->next = nullptr;
+        } else {
+            block = new Block();
+        }
+        if (lane.tail) lane.tail->next = block;
+        else lane.head = block;
+        lane.tail = block;
+        return block;
+    }
+
+    static void FreeBlocks(Block* block) {
+        while (block) {
+            Block* next = block->next;
+            delete block;
+            block = next;
+        }
+    }
+
+    std::unique_ptr<Lane[]> m_Lanes;
+    size_t                  m_LaneCount;
+    std::atomic<uint64_t>   m_Dropped{ 0 };
+};
@@ -0,0 +1,192 @@
+/*============================================================================
+ *  JobSystem.cpp - 워커 루프, 잡 슬롯 할당, 훔치기, 재우기/깨우기
+ *============================================================================*/
+#include "JobSystem.h"
+
+#include <cassert>
+
+namespace {
+
+// 이 스레드가 워커로 속한 JobSystem과 그 컨텍스트
+thread_local JobSystem* s_CurrentSystem = nullptr;
+thread_local void*      s_CurrentContext = nullptr;
+
+constexpr int kSpinBeforeSleep = 64;
+
+} // namespace
+
+JobSystem::JobSystem(unsigned workerCount) : m_OwnerThread(std::this_thread::get_id()) {
+    if (workerCount == 0) {
+        unsigned hardware = std::thread::hardware_concurrency();
+        workerCount = hardware > 1 ? hardware - 1 : 1;
+    }
+
+    for (unsigned i = 0; i <= workerCount; i++) {
+        auto context = std::make_unique<ThreadContext>();
+        context->pool.reset(new Job[kJobPoolSize]);
+        context->random = 0x9E3779B9u * (i + 1);
+        m_Contexts.push_back(std::move(context));
+    }
+    for (unsigned i = 1; i <= workerCount; i++) {
+        m_Workers.emplace_back(&JobSystem::WorkerMain, this, (size_t)i);
+    }
+}
+
+JobSystem::~JobSystem() {
+    m_Running.store(false);
+    WakeWorkers();
+    for (std::thread& worker : m_Workers) worker.join();
+}
+
+JobSystem::ThreadContext& JobSystem::GetContext() {
+    if (s_CurrentSystem == this) return *static_cast<ThreadContext*>(s_CurrentContext);
+    assert(std::this_thread::get_id() == m_OwnerThread && "잡은 만든 스레드나 워커에서만 다룰 수 있습니다");
+    return *m_Contexts[0];
+}
+
+// 이 스레드의 슬롯에서 빈 잡을 찾음. 모두 쓰이고 있으면 잡을 실행하며 기다림
+Job* JobSystem::AllocateJob() {
+    ThreadContext& context = GetContext();
+    for (;;) {
+        for (size_t tries = 0; tries < kJobPoolSize; tries++) {
+            Job& job = context.pool[context.poolCursor];
+            context.poolCursor = (context.poolCursor + 1) % kJobPoolSize;
+            if (!job.inUse.load(std::memory_order_acquire)) {
+                job.inUse.store(true, std::memory_order_relaxed);
+                job.nextWaiting = nullptr;
+                return &job;
+            }
+        }
+        if (!TryRunOne()) std::this_thread::yield();
+    }
+}
+
+void JobSystem::Run(Job* job) {
+    ThreadContext& context = GetContext();
+    if (!context.deque.Push(job)) {
+        Execute(job);   // 덱이 꽉 차면 그 자리에서 실행
+        return;
+    }
+    WakeWorkers();
+}
+
+void JobSystem::RunAfter(JobCounter& dependency, Job* job) {
+    {
+        std::lock_guard<std::mutex> lock(dependency.m_WaitMutex);
+        if (dependency.m_Pending.load(std::memory_order_acquire) != 0) {
+            job->nextWaiting = dependency.m_Waiting;
+            dependency.m_Waiting = job;
+            return;
+        }
+    }
+    Run(job);
+}
+
+void JobSystem::Wait(JobCounter& counter) {
+    while (!counter.IsDone()) {
+        if (!TryRunOne()) std::this_thread::yield();
+    }
+    // 마지막 잡이 Finish()에서 mutex를 놓을 때까지 (그 뒤에는 카운터를 지워도 됨)
+    std::lock_guard<std::mutex> lock(counter.m_WaitMutex);
+}
+
+Job* JobSystem::FindJob(ThreadContext& context) {
+    if (Job* job = context.deque.Pop()) return job;
+
+    // 임의의 위치부터 다른 덱을 한 바퀴 돌며 훔침
+    size_t count = m_Contexts.size();
+    context.random ^= context.random << 13;
+    context.random ^= context.random >> 17;
+    context.random ^= context.random << 5;
+    size_t start = context.random % count;
+    for (size_t i = 0; i < count; i++) {
+        ThreadContext& victim = *m_Contexts[(start + i) % count];
+        if (&victim == &context) continue;
+        if (Job* job = victim.deque.Steal()) {
+            m_StealCount.fetch_add(1, std::memory_order_relaxed);
+            return job;
+        }
+    }
+    return nullptr;
+}
+
+bool JobSystem::TryRunOne() {
+    Job* job = FindJob(GetContext());
+    if (!job) return false;
+    Execute(job);
+    return true;
+}
+
+void JobSystem::Execute(Job* job) {
+    JobCounter* counter = job->counter;
+    job->function(*job);
+    job->inUse.store(false, std::memory_order_release);
+    if (counter) Finish(counter);
+}
+
+// 카운터가 0이 되면 걸어 둔 잡들을 예약.
+// 0으로 만드는 마지막 감소는 mutex 안에서 해서, Wait()가 돌아간 뒤(카운터가 사라진 뒤)에는
+// 카운터를 건드리지 않게 함 (Wait는 0을 본 뒤 같은 mutex를 한 번 거침)
+void JobSystem::Finish(JobCounter* counter) {
+    int pending = counter->m_Pending.load(std::memory_order_relaxed);
+    while (pending > 1) {
+        if (counter->m_Pending.compare_exchange_weak(pending, pending - 1, std::memory_order_acq_rel,
+                                                     std::memory_order_relaxed)) {
+            return;
+        }
+    }
+
+    Job* waiting = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(counter->m_WaitMutex);
+        if (counter->m_Pending.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            waiting = counter->m_Waiting;
+            counter->m_Waiting = nullptr;
+        }
+    }
+    while (waiting) {
+        Job* next = waiting->nextWaiting;
+        Run(waiting);
+        waiting = next;
+    }
+}
+
+void JobSystem::WakeWorkers() {
+    m_WorkGeneration.fetch_add(1);
+    if (m_SleepingCount.load() > 0) {
+        std::lock_guard<std::mutex> lock(m_SleepMutex);
+        m_SleepCondition.notify_all();
+    }
+}
+
+void JobSystem::WorkerMain(size_t index) {
+    ThreadContext& context = *m_Contexts[index];
+    s_CurrentSystem = this;
+    s_CurrentContext = &context;
+
+    int idle = 0;
+    while (m_Running.load(std::memory_order_relaxed)) {
+        uint64_t generation = m_WorkGeneration.load();
+        if (Job* job = FindJob(context)) {
+            Execute(job);
+            idle = 0;
+            continue;
+        }
+        if (++idle < kSpinBeforeSleep) {
+            std::this_thread::yield();
+            continue;
+        }
+
+        // 마지막으로 본 뒤 새 잡이 들어오지 않았을 때만 잠듦
+        std::unique_lock<std::mutex> lock(m_SleepMutex);
+        m_SleepingCount.fetch_add(1);
+        m_SleepCondition.wait(lock, [&] {
+            return m_WorkGeneration.load() != generation || !m_Running.load();
+        });
+        m_SleepingCount.fetch_sub(1);
+        idle = 0;
+    }
+
+    s_CurrentSystem = nullptr;
+    s_CurrentContext = nullptr;
+}
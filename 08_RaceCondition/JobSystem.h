@@ -0,0 +1,240 @@
+/*============================================================================
+ *  JobSystem - 작업 훔치기(work-stealing) 잡 시스템
+ *  ---------------------------------------------------------------------------
+ *  BUG A~D와 F~I 데모는 작업마다 std::thread를 만들고 join합니다.
+ *  스레드 생성/종료는 잡 하나보다 수천 배 비싸서, 작은 작업을 자주 나누는
+ *  게임 루프(애니메이션, 컬링, 물리)에는 쓸 수 없습니다.
+ *
+ *  JobSystem은 시작할 때 워커 스레드를 한 번만 만들고, 스레드마다
+ *  Chase-Lev 덱(deque)을 둡니다.
+ *      Run()      : 자기 덱의 bottom에 넣음 (락 없음)
+ *      워커       : 자기 덱 bottom에서 꺼내고(LIFO, 캐시에 따뜻함),
+ *                   비면 다른 덱의 top에서 훔침(FIFO, 큰 덩어리)
+ *      Wait()     : 기다리는 스레드(메인 포함)도 잡을 꺼내 실행하며 기다림
+ *
+ *  [잡 카운터]
+ *  잡을 만들 때 JobCounter를 주면 카운터가 1 오르고, 잡이 끝나면 1 내려갑니다.
+ *      JobCounter physics;
+ *      for (...) jobs.Spawn(physics, [=] { Simulate(i); });
+ *      jobs.RunAfter(physics, jobs.Create(animation, [=] { Animate(); }));  // physics가 0이 되면 실행
+ *      jobs.Wait(animation);
+ *
+ *  [ParallelFor]
+ *  [begin, end)를 grainSize 이하가 될 때까지 반씩 나눠 잡으로 만듭니다.
+ *  나눈 뒤쪽 절반을 덱에 넣고 앞쪽을 계속 나누므로, 놀고 있는 워커가 큰 덩어리를 훔칩니다.
+ *
+ *  [제한]
+ *  - 잡은 JobSystem을 만든 스레드와 워커 스레드에서만 만들 수 있습니다.
+ *  - 잡 람다의 캡처는 kPayloadSize 바이트 이하여야 합니다 (컴파일 시간 검사).
+ *  - 잡 슬롯은 스레드마다 kJobPoolSize개입니다. 모두 쓰이면 Create가 잡을 실행하며 빈 슬롯을 기다립니다.
+ *============================================================================*/
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+class JobSystem;
+
+struct Job {
+    static constexpr size_t kPayloadSize = 64;
+
+    void (*function)(Job&) = nullptr;        // payload의 람다를 실행하고 소멸
+    class JobCounter* counter = nullptr;
+    std::atomic<bool> inUse{ false };
+    Job* nextWaiting = nullptr;               // JobCounter 대기 목록
+    alignas(std::max_align_t) unsigned char payload[kPayloadSize];
+};
+
+// 끝나지 않은 잡 수. 0이 되면 RunAfter로 걸어 둔 잡이 예약됨
+class JobCounter {
+public:
+    JobCounter() = default;
+    JobCounter(const JobCounter&) = delete;
+    JobCounter& operator=(const JobCounter&) = delete;
+
+    int GetPending() const { return m_Pending.load(std::memory_order_acquire); }
+    bool IsDone() const { return GetPending() == 0; }
+
+private:
+    friend class JobSystem;
+
+    std::atomic<int> m_Pending{ 0 };
+    std::mutex       m_WaitMutex;       // 대기 목록 등록 / 0이 될 때만 사용
+    Job*             m_Waiting = nullptr;
+};
+
+// Chase-Lev 덱 (Lê et al. 2013의 C11 메모리 순서). 주인 스레드만 Push/Pop, 누구나 Steal
+class WorkStealingDeque {
+public:
+    static constexpr int64_t kCapacity = 4096;
+
+    bool Push(Job* job) {
+        int64_t bottom = m_Bottom.load(std::memory_order_relaxed);
+        int64_t top = m_Top.load(std::memory_order_acquire);
+        if (bottom - top >= kCapacity) return false;
+        m_Buffer[bottom & (kCapacity - 1)].store(job, std::memory_order_relaxed);
+        m_Bottom.store(bottom + 1, std::memory_order_release);     // 훔치는 쪽이 job을 보고 나서 bottom을 보게
+        return true;
+    }
+
+    Job* Pop() {
+        int64_t bottom = m_Bottom.load(std::memory_order_relaxed) - 1;
+        m_Bottom.store(bottom, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t top = m_Top.load(std::memory_order_relaxed);
+
+        if (top > bottom) {
+            m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+            return nullptr;
+        }
+        Job* job = m_Buffer[bottom & (kCapacity - 1)].load(std::memory_order_relaxed);
+        if (top == bottom) {
+            // 마지막 하나: 훔치는 쪽과 top CAS로 경쟁
+            if (!m_Top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+                                               std::memory_order_relaxed)) {
+                job = nullptr;
+            }
+            m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+        }
+        return job;
+    }
+
+    Job* Steal() {
+        int64_t top = m_Top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t bottom = m_Bottom.load(std::memory_order_acquire);
+        if (top >= bottom) return nullptr;
+
+        Job* job = m_Buffer[top & (kCapacity - 1)].load(std::memory_order_relaxed);
+        if (!m_Top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+                                           std::memory_order_relaxed)) {
+            return nullptr;     // 다른 스레드가 먼저 가져감
+        }
+        return job;
+    }
+
+private:
+    alignas(64) std::atomic<int64_t> m_Top{ 0 };
+    alignas(64) std::atomic<int64_t> m_Bottom{ 0 };
+    std::atomic<Job*>                m_Buffer[kCapacity];
+};
+
+class JobSystem {
+public:
+    static constexpr size_t kJobPoolSize = 4096;
+
+    // workerCount가 0이면 (하드웨어 스레드 - 1), 최소 1
+    explicit JobSystem(unsigned workerCount = 0);
+    ~JobSystem();
+
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    // 잡을 만들기만 함 (Run/RunAfter로 예약). counter가 있으면 지금 1 올림
+    template <typename F>
+    Job* Create(JobCounter* counter, F&& function) {
+        using Fn = std::decay_t<F>;
+        static_assert(sizeof(Fn) <= Job::kPayloadSize, "잡 람다의 캡처가 너무 큽니다 (Job::kPayloadSize)");
+        static_assert(alignof(Fn) <= alignof(std::max_align_t), "잡 람다의 정렬이 너무 큽니다");
+
+        Job* job = AllocateJob();
+        new (job->payload) Fn(std::forward<F>(function));
+        job->function = [](Job& j) {
+            Fn* fn = std::launder(reinterpret_cast<Fn*>(j.payload));
+            (*fn)();
+            fn->~Fn();
+        };
+        job->counter = counter;
+        if (counter) counter->m_Pending.fetch_add(1, std::memory_order_relaxed);
+        return job;
+    }
+
+    template <typename F>
+    Job* Create(JobCounter& counter, F&& function) { return Create(&counter, std::forward<F>(function)); }
+
+    // 호출한 스레드의 덱에 넣음
+    void Run(Job* job);
+
+    // dependency가 0이 되면(이미 0이면 바로) 예약
+    void RunAfter(JobCounter& dependency, Job* job);
+
+    template <typename F>
+    void Spawn(JobCounter& counter, F&& function) { Run(Create(&counter, std::forward<F>(function))); }
+
+    // counter가 0이 될 때까지 잡을 실행하며 기다림
+    void Wait(JobCounter& counter);
+
+    // body(rangeBegin, rangeEnd)를 grainSize 이하 구간으로 나눠 병렬 실행하고 끝날 때까지 기다림
+    template <typename Body>
+    void ParallelFor(size_t begin, size_t end, size_t grainSize, const Body& body) {
+        if (begin >= end) return;
+        JobCounter counter;
+        Run(Create(&counter, ParallelForTask<Body>{ this, &counter, &body, begin, end, grainSize ? grainSize : 1 }));
+        Wait(counter);
+    }
+
+    unsigned GetWorkerCount() const { return (unsigned)m_Workers.size(); }
+
+    // 지금까지 다른 스레드의 덱에서 훔친 잡 수
+    uint64_t GetStealCount() const { return m_StealCount.load(std::memory_order_relaxed); }
+
+private:
+    template <typename Body>
+    struct ParallelForTask {
+        JobSystem*  system;
+        JobCounter* counter;
+        const Body* body;
+        size_t      begin;
+        size_t      end;
+        size_t      grainSize;
+
+        void operator()() const {
+            size_t first = begin;
+            size_t last = end;
+            // 뒤쪽 절반은 잡으로 내놓고 앞쪽을 계속 나눔
+            while (last - first > grainSize) {
+                size_t middle = first + (last - first) / 2;
+                system->Run(system->Create(counter, ParallelForTask{ system, counter, body, middle, last, grainSize }));
+                last = middle;
+            }
+            (*body)(first, last);
+        }
+    };
+
+    struct alignas(64) ThreadContext {
+        WorkStealingDeque      deque;
+        std::unique_ptr<Job[]> pool;
+        size_t                 poolCursor = 0;
+        uint32_t               random = 0;
+    };
+
+    Job* AllocateJob();
+    Job* FindJob(ThreadContext& context);
+    bool TryRunOne();
+    void Execute(Job* job);
+    void Finish(JobCounter* counter);
+    void WorkerMain(size_t index);
+    void WakeWorkers();
+    ThreadContext& GetContext();
+
+    std::vector<std::unique_ptr<ThreadContext>> m_Contexts;     // [0] = 만든 스레드, [1..] = 워커
+    std::thread::id                             m_OwnerThread;
+    std::vector<std::thread>                    m_Workers;
+    std::atomic<bool>                           m_Running{ true };
+    std::atomic<uint64_t>                       m_StealCount{ 0 };
+
+    // 할 일이 없을 때 워커를 재움
+    std::mutex                                  m_SleepMutex;
+    std::condition_variable                     m_SleepCondition;
+    std::atomic<uint64_t>                       m_WorkGeneration{ 0 };
+    std::atomic<int>                            m_SleepingCount{ 0 };
+};
@@ -0,0 +1,105 @@
+/*============================================================================
+ *  MpscRing - 크기 고정 lock-free 다중 생산자 / 단일 소비자 링 버퍼
+ *  ---------------------------------------------------------------------------
+ *  BUG D는 여러 스레드가 vector 하나에 push_back해서 재할당 중에 메모리가 깨집니다.
+ *  mutex로 감싸면 안전하지만 게임 스레드가 로그 한 줄 때문에 락을 기다립니다.
+ *
+ *  MpscRing은 칸마다 순번(sequence)을 두는 방식(Vyukov bounded queue)입니다.
+ *      생산자: tail을 CAS로 한 칸 예약 → 값 기록 → 순번을 pos + 1로 공개
+ *      소비자: 순번이 pos + 1인 칸만 읽고, pos + 용량으로 바꿔 다음 바퀴에 돌려줌
+ *  - TryPush(): 기다리지 않음. 꽉 차면 false를 돌려주고 DroppedCount를 올림
+ *  - PopBatch(): 공개된 칸을 최대 maxCount개까지 한 번에 꺼냄 (소비자 스레드 하나만)
+ *  한 생산자가 넣은 값은 넣은 순서대로 나옵니다.
+ *
+ *  [예]
+ *      MpscRing<LogEntry> ring(1 << 16);
+ *      ring.TryPush(entry);                         // 게임 스레드 (여러 개)
+ *      size_t n = ring.PopBatch(batch, 256);        // 로그 스레드 (하나)
+ *============================================================================*/
+#pragma once
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+template <typename T>
+class MpscRing {
+public:
+    static constexpr size_t kCacheLineSize = 64;
+
+    // capacity는 2의 거듭제곱
+    explicit MpscRing(size_t capacity)
+        : m_Cells(new Cell[capacity]), m_Capacity(capacity), m_Mask(capacity - 1) {
+        assert(capacity >= 2 && (capacity & (capacity - 1)) == 0 && "capacity는 2의 거듭제곱이어야 합니다");
+        for (size_t i = 0; i < capacity; i++) m_Cells[i].sequence.store(i, std::memory_order_relaxed);
+    }
+
+    MpscRing(const MpscRing&) = delete;
+    MpscRing& operator=(const MpscRing&) = delete;
+
+    // 생산자 (여러 스레드). 꽉 차면 기다리지 않고 false
+    bool TryPush(const T& value) {
+        size_t pos = m_Tail.value.load(std::memory_order_relaxed);
+        for (;;) {
+            Cell& cell = m_Cells[pos & m_Mask];
+            size_t sequence = cell.sequence.load(std::memory_order_acquire);
+            intptr_t diff = (intptr_t)sequence - (intptr_t)pos;
+            if (diff == 0) {
+                // 빈 칸: 예약 성공 시 기록 후 공개
+                if (m_Tail.value.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    cell.value = value;
+                    cell.sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                // 소비자가 아직 이 칸을 비우지 않음 → 꽉 참
+                m_Dropped.value.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            } else {
+                // 다른 생산자가 먼저 예약함
+                pos = m_Tail.value.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // 소비자 (한 스레드만). 공개된 값을 최대 maxCount개 꺼내고 개수를 돌려줌
+    size_t PopBatch(T* out, size_t maxCount) {
+        size_t pos = m_Head;
+        size_t count = 0;
+        while (count < maxCount) {
+            Cell& cell = m_Cells[pos & m_Mask];
+            if (cell.sequence.load(std::memory_order_acquire) != pos + 1) break;
+            out[count++] = cell.value;
+            cell.sequence.store(pos + m_Capacity, std::memory_order_release);
+            pos++;
+        }
+        m_Head = pos;
+        return count;
+    }
+
+    bool TryPop(T& out) { return PopBatch(&out, 1) == 1; }
+
+    size_t GetCapacity() const { return m_Capacity; }
+    uint64_t GetDroppedCount() const { return m_Dropped.value.load(std::memory_order_relaxed); }
+
+private:
+    struct Cell {
+        std::atomic<size_t> sequence;
+        T                   value;
+    };
+
+    // 생산자가 치는 tail과 소비자 전용 head를 다른 캐시 라인에
+    template <typename V>
+    struct alignas(kCacheLineSize) Padded {
+        V value{};
+    };
+
+    std::unique_ptr<Cell[]>          m_Cells;
+    size_t                           m_Capacity;
+    size_t                           m_Mask;
+    Padded<std::atomic<size_t>>      m_Tail;
+    Padded<std::atomic<uint64_t>>    m_Dropped;
+    alignas(kCacheLineSize) size_t   m_Head = 0;
+};
@@ -0,0 +1,163 @@
+/*============================================================================
+ *  PhiloxRng.cpp - 블록 4개(SSE4.1) / 8개(AVX2)를 레인에 나란히 계산
+ *  ---------------------------------------------------------------------------
+ *  레인 하나가 블록 하나입니다. 카운터 워드 c0~c3을 각각 벡터 하나에 두고(SoA)
+ *  라운드를 돌린 뒤, 4x4 전치로 블록 순서(AoS)로 바꿔 float으로 변환합니다.
+ *  32x32 → 64비트 곱은 짝수/홀수 레인을 mul_epu32 두 번으로 나눠 계산합니다.
+ *============================================================================*/
+#include "PhiloxRng.h"
+#include "SimdDispatch.h"
+
+namespace {
+
+constexpr float kUnitScale = 1.0f / 16777216.0f;
+
+// ----------------------------------------------------------------------------
+// SSE4.1: 블록 4개 → float 16개
+// ----------------------------------------------------------------------------
+SIMD_TARGET_SSE41 inline void MulHiLoSSE(__m128i a, __m128i m, __m128i& hi, __m128i& lo) {
+    __m128i even = _mm_mul_epu32(a, m);                        // 레인 0, 2
+    __m128i odd = _mm_mul_epu32(_mm_srli_epi64(a, 32), m);     // 레인 1, 3
+    lo = _mm_blend_epi16(even, _mm_slli_epi64(odd, 32), 0xCC);
+    hi = _mm_blend_epi16(_mm_srli_epi64(even, 32), odd, 0xCC);
+}
+
+SIMD_TARGET_SSE41 void GenerateBlocksSSE(uint64_t firstBlock, const uint32_t stream[2], const uint32_t key[2],
+                                         float* out) {
+    __m128i c0 = _mm_setr_epi32((int)(uint32_t)firstBlock, (int)(uint32_t)(firstBlock + 1),
+                                (int)(uint32_t)(firstBlock + 2), (int)(uint32_t)(firstBlock + 3));
+    __m128i c1 = _mm_setr_epi32((int)(uint32_t)(firstBlock >> 32), (int)(uint32_t)((firstBlock + 1) >> 32),
+                                (int)(uint32_t)((firstBlock + 2) >> 32), (int)(uint32_t)((firstBlock + 3) >> 32));
+    __m128i c2 = _mm_set1_epi32((int)stream[0]);
+    __m128i c3 = _mm_set1_epi32((int)stream[1]);
+    __m128i k0 = _mm_set1_epi32((int)key[0]);
+    __m128i k1 = _mm_set1_epi32((int)key[1]);
+    const __m128i m0 = _mm_set1_epi32((int)PhiloxRng::kMultiplier0);
+    const __m128i m1 = _mm_set1_epi32((int)PhiloxRng::kMultiplier1);
+    const __m128i w0 = _mm_set1_epi32((int)PhiloxRng::kWeyl0);
+    const __m128i w1 = _mm_set1_epi32((int)PhiloxRng::kWeyl1);
+
+    for (int round = 0; round < PhiloxRng::kRounds; round++) {
+        __m128i hi0, lo0, hi1, lo1;
+        MulHiLoSSE(c0, m0, hi0, lo0);
+        MulHiLoSSE(c2, m1, hi1, lo1);
+        c0 = _mm_xor_si128(_mm_xor_si128(hi1, c1), k0);
+        c1 = lo1;
+        c2 = _mm_xor_si128(_mm_xor_si128(hi0, c3), k1);
+        c3 = lo0;
+        k0 = _mm_add_epi32(k0, w0);
+        k1 = _mm_add_epi32(k1, w1);
+    }
+
+    // 전치: 레인 = 블록 → 벡터 = 블록
+    __m128i t0 = _mm_unpacklo_epi32(c0, c1);
+    __m128i t1 = _mm_unpacklo_epi32(c2, c3);
+    __m128i t2 = _mm_unpackhi_epi32(c0, c1);
+    __m128i t3 = _mm_unpackhi_epi32(c2, c3);
+    __m128i blocks[4] = {
+        _mm_unpacklo_epi64(t0, t1), _mm_unpackhi_epi64(t0, t1),
+        _mm_unpacklo_epi64(t2, t3), _mm_unpackhi_epi64(t2, t3),
+    };
+    const __m128 scale = _mm_set1_ps(kUnitScale);
+    for (int b = 0; b < 4; b++) {
+        __m128 f = _mm_mul_ps(_mm_cvtepi32_ps(_mm_srli_epi32(blocks[b], 8)), scale);
+        _mm_storeu_ps(out + b * 4, f);
+    }
+}
+
+// ----------------------------------------------------------------------------
+// AVX2: 블록 8개 → float 32개
+// ----------------------------------------------------------------------------
+SIMD_TARGET_AVX2 inline void MulHiLoAVX2(__m256i a, __m256i m, __m256i& hi, __m256i& lo) {
+    __m256i even = _mm256_mul_epu32(a, m);
+    __m256i odd = _mm256_mul_epu32(_mm256_srli_epi64(a, 32), m);
+    lo = _mm256_blend_epi32(even, _mm256_slli_epi64(odd, 32), 0xAA);
+    hi = _mm256_blend_epi32(_mm256_srli_epi64(even, 32), odd, 0xAA);
+}
+
+SIMD_TARGET_AVX2 void GenerateBlocksAVX2(uint64_t firstBlock, const uint32_t stream[2], const uint32_t key[2],
+                                         float* out) {
+    alignas(32) uint32_t lo[8], hi[8];
+    for (int i = 0; i < 8; i++) {
+        lo[i] = (uint32_t)(firstBlock + i);
+        hi[i] = (uint32_t)((firstBlock + i) >> 32);
+    }
+    __m256i c0 = _mm256_load_si256(reinterpret_cast<const __m256i*>(lo));
+    __m256i c1 = _mm256_load_si256(reinterpret_cast<const __m256i*>(hi));
+    __m256i c2 = _mm256_set1_epi32((int)stream[0]);
+    __m256i c3 = _mm256_set1_epi32((int)stream[1]);
+    __m256i k0 = _mm256_set1_epi32((int)key[0]);
+    __m256i k1 = _mm256_set1_epi32((int)key[1]);
+    const __m256i m0 = _mm256_set1_epi32((int)PhiloxRng::kMultiplier0);
+    const __m256i m1 = _mm256_set1_epi32((int)PhiloxRng::kMultiplier1);
+    const __m256i w0 = _mm256_set1_epi32((int)PhiloxRng::kWeyl0);
+    const __m256i w1 = _mm256_set1_epi32((int)PhiloxRng::kWeyl1);
+
+    for (int round = 0; round < PhiloxRng::kRounds; round++) {
+        __m256i hi0, lo0, hi1, lo1;
+        MulHiLoAVX2(c0, m0, hi0, lo0);
+        MulHiLoAVX2(c2, m1, hi1, lo1);
+        c0 = _mm256_xor_si256(_mm256_xor_si256(hi1, c1), k0);
+        c1 = lo1;
+        c2 = _mm256_xor_si256(_mm256_xor_si256(hi0, c3), k1);
+        c3 = lo0;
+        k0 = _mm256_add_epi32(k0, w0);
+        k1 = _mm256_add_epi32(k1, w1);
+    }
+
+    // 128비트 레인 안에서 전치 → [블록 b | 블록 b+4] → 레인을 다시 짝지음
+    __m256i t0 = _mm256_unpacklo_epi32(c0, c1);
+    __m256i t1 = _mm256_unpacklo_epi32(c2, c3);
+    __m256i t2 = _mm256_unpackhi_epi32(c0, c1);
+    __m256i t3 = _mm256_unpackhi_epi32(c2, c3);
+    __m256i b04 = _mm256_unpacklo_epi64(t0, t1);
+    __m256i b15 = _mm256_unpackhi_epi64(t0, t1);
+    __m256i b26 = _mm256_unpacklo_epi64(t2, t3);
+    __m256i b37 = _mm256_unpackhi_epi64(t2, t3);
+    __m256i pairs[4] = {
+        _mm256_permute2x128_si256(b04, b15, 0x20),     // 블록 0, 1
+        _mm256_permute2x128_si256(b26, b37, 0x20),     // 블록 2, 3
+        _mm256_permute2x128_si256(b04, b15, 0x31),     // 블록 4, 5
+        _mm256_permute2x128_si256(b26, b37, 0x31),     // 블록 6, 7
+    };
+    const __m256 scale = _mm256_set1_ps(kUnitScale);
+    for (int p = 0; p < 4; p++) {
+        __m256 f = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_srli_epi32(pairs[p], 8)), scale);
+        _mm256_storeu_ps(out + p * 8, f);
+    }
+}
+
+} // namespace
+
+void PhiloxRng::FillUniform(float* out, size_t count) {
+    // 1) 버퍼에 남은 출력부터
+    while (count > 0 && m_BufferPos < 4) {
+        *out++ = ToUnitFloat(m_Buffer[m_BufferPos++]);
+        count--;
+    }
+
+    // 2) 온전한 블록은 SIMD로
+    size_t blocks = count / 4;
+    size_t done = 0;
+    switch (GetSimdLevel()) {
+    case SimdLevel::AVX2:
+        for (; done + 8 <= blocks; done += 8) GenerateBlocksAVX2(m_Block + done, m_Stream, m_Key, out + done * 4);
+        [[fallthrough]];
+    case SimdLevel::SSE41:
+        for (; done + 4 <= blocks; done += 4) GenerateBlocksSSE(m_Block + done, m_Stream, m_Key, out + done * 4);
+        break;
+    default:
+        break;
+    }
+    for (; done < blocks; done++) {
+        uint32_t bits[4];
+        GenerateBlock(m_Block + done, bits);
+        for (int i = 0; i < 4; i++) out[done * 4 + i] = ToUnitFloat(bits[i]);
+    }
+    m_Block += blocks;
+    out += blocks * 4;
+    count -= blocks * 4;
+
+    // 3) 남은 1~3개는 새 블록을 버퍼에 만들고 앞부분만 사용
+    for (size_t i = 0; i < count; i++) out[i] = NextFloat();
+}
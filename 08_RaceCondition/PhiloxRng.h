@@ -0,0 +1,102 @@
+/*============================================================================
+ *  PhiloxRng - 카운터 기반 난수 (Philox4x32-10), 스트림별 독립 + SIMD 배치
+ *  ---------------------------------------------------------------------------
+ *  BUG C는 static std::mt19937 하나를 여러 스레드가 같이 돌려서 상태가 깨집니다.
+ *  스레드마다 mt19937을 두면 안전하지만, 결과가 "어느 스레드가 어느 엔티티를
+ *  처리했는가"에 따라 달라져 스레드 수를 바꾸면 재현되지 않습니다.
+ *
+ *  Philox는 상태를 돌리지 않고 (카운터, 키)를 섞어서 바로 난수를 만듭니다.
+ *      키      = seed (64비트)
+ *      카운터  = (블록 번호 64비트, stream0, stream1)
+ *      출력    = Philox4x32-10(카운터, 키) → 블록당 uint32 4개
+ *  (seed, 엔티티 ID)로 스트림을 만들면 어떤 스레드가 몇 개로 나눠 처리해도 같은 값이 나옵니다.
+ *  mt19937(2.5KB)과 달리 상태가 수십 바이트라 엔티티마다 만들어도 부담이 없습니다.
+ *
+ *  FillUniform()은 블록 4개(SSE4.1) / 8개(AVX2)를 SIMD 레인에 나란히 계산합니다.
+ *  결과는 같은 수만큼 NextFloat()를 부른 것과 비트 단위로 같습니다.
+ *
+ *  [예]
+ *      PhiloxRng rng(seed, entityId);
+ *      float x = rng.NextFloat();              // [0, 1)
+ *      rng.FillUniform(buffer, 1024);          // 같은 스트림에서 이어서 1024개
+ *============================================================================*/
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+class PhiloxRng {
+public:
+    static constexpr uint32_t kMultiplier0 = 0xD2511F53u;
+    static constexpr uint32_t kMultiplier1 = 0xCD9E8D57u;
+    static constexpr uint32_t kWeyl0 = 0x9E3779B9u;      // 라운드마다 키에 더하는 값
+    static constexpr uint32_t kWeyl1 = 0xBB67AE85u;
+    static constexpr int kRounds = 10;
+
+    PhiloxRng(uint64_t seed, uint32_t stream0, uint32_t stream1 = 0) {
+        m_Key[0] = (uint32_t)seed;
+        m_Key[1] = (uint32_t)(seed >> 32);
+        m_Stream[0] = stream0;
+        m_Stream[1] = stream1;
+    }
+
+    // 블록 하나: counter[4], key[2] → out[4]
+    static void Generate(const uint32_t counter[4], const uint32_t key[2], uint32_t out[4]) {
+        uint32_t c0 = counter[0], c1 = counter[1], c2 = counter[2], c3 = counter[3];
+        uint32_t k0 = key[0], k1 = key[1];
+        for (int round = 0; round < kRounds; round++) {
+            uint64_t p0 = (uint64_t)kMultiplier0 * c0;
+            uint64_t p1 = (uint64_t)kMultiplier1 * c2;
+            c0 = (uint32_t)(p1 >> 32) ^ c1 ^ k0;
+            c1 = (uint32_t)p1;
+            c2 = (uint32_t)(p0 >> 32) ^ c3 ^ k1;
+            c3 = (uint32_t)p0;
+            k0 += kWeyl0;
+            k1 += kWeyl1;
+        }
+        out[0] = c0; out[1] = c1; out[2] = c2; out[3] = c3;
+    }
+
+    uint32_t NextUInt() {
+        if (m_BufferPos == 4) {
+            GenerateBlock(m_Block++, m_Buffer);
+            m_BufferPos = 0;
+        }
+        return m_Buffer[m_BufferPos++];
+    }
+
+    // [0, 1) - 상위 24비트 (float으로 정확히 표현되는 범위)
+    float NextFloat() { return ToUnitFloat(NextUInt()); }
+
+    // [min, max)
+    float NextFloat(float min, float max) { return min + (max - min) * NextFloat(); }
+
+    // count개를 NextFloat()와 같은 순서로 채움 (SIMD 배치)
+    void FillUniform(float* out, size_t count);
+
+    // 스트림의 position번째 출력으로 이동 (앞 출력을 만들 필요 없음)
+    void SetPosition(uint64_t position) {
+        m_Block = position / 4;
+        m_BufferPos = 4;
+        if (position % 4 != 0) {
+            GenerateBlock(m_Block++, m_Buffer);
+            m_BufferPos = (unsigned)(position % 4);
+        }
+    }
+
+    uint64_t GetPosition() const { return m_Block * 4 - (m_BufferPos == 4 ? 0 : 4 - m_BufferPos); }
+
+    static float ToUnitFloat(uint32_t bits) { return (float)(bits >> 8) * (1.0f / 16777216.0f); }
+
+private:
+    void GenerateBlock(uint64_t block, uint32_t out[4]) const {
+        uint32_t counter[4] = { (uint32_t)block, (uint32_t)(block >> 32), m_Stream[0], m_Stream[1] };
+        Generate(counter, m_Key, out);
+    }
+
+    uint32_t m_Key[2];
+    uint32_t m_Stream[2];
+    uint64_t m_Block = 0;           // 다음에 만들 블록 번호
+    uint32_t m_Buffer[4] = {};
+    unsigned m_BufferPos = 4;       // 4면 비어 있음
+};
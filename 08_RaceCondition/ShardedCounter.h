@@ -0,0 +1,76 @@
+/*============================================================================
+ *  ShardedCounter - 스레드마다 캐시 라인 하나씩 쓰는 통계 카운터
+ *  ---------------------------------------------------------------------------
+ *  BUG B(sharedScore++)의 일반적인 수정은 std::atomic<int>입니다.
+ *  값은 맞지만 모든 코어가 같은 캐시 라인에 fetch_add를 하므로
+ *  스레드가 늘수록 그 라인이 코어 사이를 왕복(ping-pong)하며 느려집니다.
+ *
+ *  ShardedCounter는 64바이트로 정렬한 슬롯을 스레드마다 하나씩 둡니다.
+ *  - Add(): 자기 슬롯만 씀. 쓰는 스레드가 하나뿐이라 RMW 없이 load + store
+ *  - Read(): 모든 슬롯을 더함 (O(슬롯 수), 통계 표시용)
+ *  값을 자주 더하고 가끔 읽는 점수/통계/프로파일 카운터에 맞습니다.
+ *
+ *  [스레드 번호]
+ *  슬롯은 GetThreadIndex()(살아 있는 스레드마다 고유한 작은 번호)로 고릅니다.
+ *  번호가 슬롯 수 이상이면 공용 슬롯에 fetch_add로 더합니다 (느리지만 값은 정확).
+ *
+ *  [주의] Read()는 진행 중인 Add()를 일부만 볼 수 있습니다 (모든 Add가 끝난 뒤에는 정확).
+ *  Reset()은 다른 스레드가 Add()하지 않을 때만 호출하세요.
+ *============================================================================*/
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "ThreadIndex.h"
+
+class ShardedCounter {
+public:
+    static constexpr size_t kCacheLineSize = 64;
+    static constexpr size_t kDefaultShardCount = 64;
+
+    explicit ShardedCounter(size_t shardCount = kDefaultShardCount)
+        : m_Shards(new Shard[shardCount]), m_ShardCount(shardCount) {}
+
+    ShardedCounter(const ShardedCounter&) = delete;
+    ShardedCounter& operator=(const ShardedCounter&) = delete;
+
+    void Add(int64_t delta) {
+        size_t index = GetThreadIndex();
+        if (index < m_ShardCount) {
+            // 이 슬롯에 쓰는 스레드는 하나뿐 → RMW 없이 load + store
+            std::atomic<int64_t>& value = m_Shards[index].value;
+            value.store(value.load(std::memory_order_relaxed) + delta, std::memory_order_relaxed);
+        } else {
+            m_Shared.value.fetch_add(delta, std::memory_order_relaxed);
+        }
+    }
+
+    void Increment() { Add(1); }
+
+    int64_t Read() const {
+        int64_t sum = m_Shared.value.load(std::memory_order_relaxed);
+        for (size_t i = 0; i < m_ShardCount; i++) {
+            sum += m_Shards[i].value.load(std::memory_order_relaxed);
+        }
+        return sum;
+    }
+
+    void Reset() {
+        for (size_t i = 0; i < m_ShardCount; i++) m_Shards[i].value.store(0, std::memory_order_relaxed);
+        m_Shared.value.store(0, std::memory_order_relaxed);
+    }
+
+    size_t GetShardCount() const { return m_ShardCount; }
+
+private:
+    struct alignas(kCacheLineSize) Shard {
+        std::atomic<int64_t> value{ 0 };
+    };
+
+    std::unique_ptr<Shard[]> m_Shards;
+    size_t                   m_ShardCount;
+    Shard                    m_Shared;      // 슬롯 수보다 많은 스레드용 (fetch_add)
+};
@@ -0,0 +1,85 @@
+/*============================================================================
+ *  SpscRing - 크기 고정 lock-free 단일 생산자 / 단일 소비자 링 버퍼
+ *  ---------------------------------------------------------------------------
+ *  생산자가 하나뿐이면 MpscRing의 tail CAS도, 칸마다 두는 순번도 필요 없습니다.
+ *      생산자: 칸에 값 기록 → tail을 release로 공개
+ *      소비자: tail을 acquire로 읽고 그 앞까지 꺼냄 → head를 release로 돌려줌
+ *  상대편 인덱스는 캐시(m_CachedHead / m_CachedTail)해 두고, 꽉 찼거나 비었다고
+ *  보일 때만 다시 읽습니다. 그래서 평소에는 상대편 캐시 라인을 건드리지 않습니다.
+ *
+ *  - TryPush(): 기다리지 않음. 꽉 차면 false를 돌려주고 DroppedCount를 올림
+ *  - PopBatch(): 쌓인 값을 최대 maxCount개까지 한 번에 꺼냄
+ *
+ *  [주의] TryPush는 한 스레드에서만, PopBatch는 (다른) 한 스레드에서만 호출하세요.
+ *  생산자 스레드를 바꾸려면 이전 생산자와 새 생산자 사이에 동기화(join, mutex 등)가 있어야 합니다.
+ *============================================================================*/
+#pragma once
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+template <typename T>
+class SpscRing {
+public:
+    static constexpr size_t kCacheLineSize = 64;
+
+    // capacity는 2의 거듭제곱
+    explicit SpscRing(size_t capacity)
+        : m_Items(new T[capacity]), m_Capacity(capacity), m_Mask(capacity - 1) {
+        assert(capacity >= 2 && (capacity & (capacity - 1)) == 0 && "capacity는 2의 거듭제곱이어야 합니다");
+    }
+
+    SpscRing(const SpscRing&) = delete;
+    SpscRing& operator=(const SpscRing&) = delete;
+
+    // 생산자 (한 스레드). 꽉 차면 기다리지 않고 false
+    bool TryPush(const T& value) {
+        size_t tail = m_Tail.load(std::memory_order_relaxed);
+        if (tail - m_CachedHead >= m_Capacity) {
+            m_CachedHead = m_Head.load(std::memory_order_acquire);
+            if (tail - m_CachedHead >= m_Capacity) {
+                m_Dropped.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+        }
+        m_Items[tail & m_Mask] = value;
+        m_Tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    // 소비자 (한 스레드). 쌓인 값을 최대 maxCount개 꺼내고 개수를 돌려줌
+    size_t PopBatch(T* out, size_t maxCount) {
+        size_t head = m_Head.load(std::memory_order_relaxed);
+        if (head == m_CachedTail) {
+            m_CachedTail = m_Tail.load(std::memory_order_acquire);
+            if (head == m_CachedTail) return 0;
+        }
+        size_t count = m_CachedTail - head;
+        if (count > maxCount) count = maxCount;
+        for (size_t i = 0; i < count; i++) out[i] = m_Items[(head + i) & m_Mask];
+        m_Head.store(head + count, std::memory_order_release);
+        return count;
+    }
+
+    bool TryPop(T& out) { return PopBatch(&out, 1) == 1; }
+
+    size_t GetCapacity() const { return m_Capacity; }
+    uint64_t GetDroppedCount() const { return m_Dropped.load(std::memory_order_relaxed); }
+
+private:
+    std::unique_ptr<T[]> m_Items;
+    size_t               m_Capacity;
+    size_t               m_Mask;
+
+    // 생산자 쪽 (tail + 생산자가 본 head)
+    alignas(kCacheLineSize) std::atomic<size_t> m_Tail{ 0 };
+    size_t                                      m_CachedHead = 0;
+    std::atomic<uint64_t>                       m_Dropped{ 0 };
+
+    // 소비자 쪽 (head + 소비자가 본 tail)
+    alignas(kCacheLineSize) std::atomic<size_t> m_Head{ 0 };
+    size_t                                      m_CachedTail = 0;
+};
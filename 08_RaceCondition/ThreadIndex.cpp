@@ -0,0 +1,44 @@
+/*============================================================================
+ *  ThreadIndex.cpp - 스레드 번호 배정 (스레드 시작/종료 때만 락)
+ *============================================================================*/
+#include "ThreadIndex.h"
+
+#include <mutex>
+#include <vector>
+
+namespace {
+
+std::mutex& GetRegistryMutex() {
+    static std::mutex s_Mutex;
+    return s_Mutex;
+}
+
+std::vector<bool>& GetUsedIndices() {
+    static std::vector<bool> s_Used;
+    return s_Used;
+}
+
+} // namespace
+
+namespace ThreadIndexDetail {
+
+size_t AcquireThreadIndex() {
+    std::lock_guard<std::mutex> lock(GetRegistryMutex());
+    std::vector<bool>& used = GetUsedIndices();
+    for (size_t i = 0; i < used.size(); i++) {
+        if (!used[i]) {
+            used[i] = true;
+            return i;
+        }
+    }
+    used.push_back(true);
+    return used.size() - 1;
+}
+
+// 반납한 번호를 받는 새 스레드는 같은 mutex를 거치므로 이전 스레드의 마지막 store를 봄
+void ReleaseThreadIndex(size_t index) {
+    std::lock_guard<std::mutex> lock(GetRegistryMutex());
+    GetUsedIndices()[index] = false;
+}
+
+} // namespace ThreadIndexDetail
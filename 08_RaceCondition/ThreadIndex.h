@@ -0,0 +1,32 @@
+/*============================================================================
+ *  ThreadIndex - 살아 있는 스레드마다 고유한 작은 번호 (0, 1, 2, ...)
+ *  ---------------------------------------------------------------------------
+ *  스레드별 슬롯/버퍼 배열의 인덱스로 씁니다 (ShardedCounter, FrameAppendLog).
+ *  스레드는 처음 GetThreadIndex()를 부를 때 가장 작은 빈 번호를 받고,
+ *  종료할 때 반납합니다. 그래서 스레드를 만들고 없애도 번호가 계속 커지지 않습니다.
+ *
+ *  같은 번호를 동시에 가진 스레드는 없습니다. 번호를 반납/재배정할 때
+ *  같은 mutex를 거치므로, 새 주인은 이전 주인이 그 슬롯에 쓴 값을 모두 봅니다.
+ *============================================================================*/
+#pragma once
+
+#include <cstddef>
+
+namespace ThreadIndexDetail {
+
+// 스레드 시작/종료 때 한 번씩만 호출됨 (mutex)
+size_t AcquireThreadIndex();
+void ReleaseThreadIndex(size_t index);
+
+struct ThreadIndexHolder {
+    size_t index;
+    ThreadIndexHolder() : index(AcquireThreadIndex()) {}
+    ~ThreadIndexHolder() { ReleaseThreadIndex(index); }
+};
+
+} // namespace ThreadIndexDetail
+
+inline size_t GetThreadIndex() {
+    thread_local ThreadIndexDetail::ThreadIndexHolder s_Holder;
+    return s_Holder.index;
+}
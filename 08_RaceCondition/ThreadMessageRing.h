@@ -0,0 +1,77 @@
+/*============================================================================
+ *  ThreadMessageRing - 스레드별로 돌려 쓰는 에러 메시지 버퍼
+ *  ---------------------------------------------------------------------------
+ *  BUG A의 what()은 static char s_str[64] 하나를 모든 스레드가 덮어씁니다.
+ *  mutex로 감싸면 손상은 막지만 what()마다 락 경쟁이 생기고,
+ *  돌려준 포인터는 락을 푼 뒤 다시 덮어쓸 수 있어서 결국 복사가 필요합니다.
+ *
+ *  ThreadMessageRing은 스레드마다 kSlotSize 바이트 슬롯 kSlotCount개를 두고
+ *  가장 오래된 슬롯부터 돌려 씁니다. 공유 상태가 없으므로 락도 없습니다.
+ *
+ *  [지연 포맷]
+ *  예외 객체는 에러 코드만 들고 있고, 문자열은 첫 what()에서 만듭니다.
+ *  같은 key(예: 예외 종류 + HRESULT)의 메시지가 링에 남아 있으면 다시 포맷하지 않습니다.
+ *
+ *      const char* what() const noexcept {
+ *          return ThreadMessageRing::Get().GetOrFormat(key, [&](char* buffer, size_t size) {
+ *              snprintf(buffer, size, "Failure with HRESULT of %08X", result);
+ *          });
+ *      }
+ *
+ *  [수명] 돌려준 포인터는 같은 스레드가 새 메시지를 kSlotCount개 더 만들 때까지 유효합니다.
+ *  오래 보관하거나 다른 스레드로 넘길 문자열은 복사하세요.
+ *============================================================================*/
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+class ThreadMessageRing {
+public:
+    static constexpr size_t kSlotCount = 8;
+    static constexpr size_t kSlotSize = 128;
+
+    // 호출한 스레드의 링
+    static ThreadMessageRing& Get() {
+        thread_local ThreadMessageRing s_Ring;
+        return s_Ring;
+    }
+
+    // key로 만든 메시지가 아직 링에 있으면 돌려줌 (key 0은 빈 슬롯)
+    const char* Find(uint64_t key) const {
+        for (size_t i = 0; i < kSlotCount; i++) {
+            if (m_Keys[i] == key) return m_Text[i];
+        }
+        return nullptr;
+    }
+
+    // 가장 오래된 슬롯을 key에 배정하고 쓸 버퍼(kSlotSize 바이트)를 돌려줌
+    char* Claim(uint64_t key) {
+        size_t slot = m_Next;
+        m_Next = (m_Next + 1) % kSlotCount;
+        m_Keys[slot] = key;
+        m_Text[slot][0] = '\0';
+        m_FormatCount++;
+        return m_Text[slot];
+    }
+
+    // 링에 없을 때만 format(buffer, kSlotSize)을 호출
+    template <typename Format>
+    const char* GetOrFormat(uint64_t key, Format&& format) {
+        if (const char* text = Find(key)) return text;
+        char* buffer = Claim(key);
+        format(buffer, kSlotSize);
+        return buffer;
+    }
+
+    // 이 스레드에서 실제로 포맷한 횟수
+    uint64_t FormatCount() const { return m_FormatCount; }
+
+private:
+    ThreadMessageRing() = default;
+
+    uint64_t m_Keys[kSlotCount] = {};
+    char     m_Text[kSlotCount][kSlotSize];
+    size_t   m_Next = 0;
+    uint64_t m_FormatCount = 0;
+};
@@ -6,6 +6,7 @@
  *
  *  [교육 목표] 스레드 안전하지 않은 코드를 찾고 mutex/thread_local 등으로 수정하세요.
  *============================================================================*/
+#include <algorithm>
 #include <iostream>
 #include <string>
 #include <vector>
@@ -16,6 +17,19 @@
 #include <chrono>
 #include <sstream>
 #include <cstdio>
+#include <cstring>
+#include <iomanip>
+#include <memory_resource>
+
+#include "AsyncLogger.h"
+#include "FrameAllocator.h"
+#include "FrameAppendLog.h"
+#include "JobSystem.h"
+#include "MpscRing.h"
+#include "PhiloxRng.h"
+#include "ShardedCounter.h"
+#include "SimdDispatch.h"
+#include "ThreadMessageRing.h"
 
 // ============================================================================
 // BUG A: static 버퍼를 여러 스레드가 공유
@@ -160,6 +174,884 @@ void BugD_VectorRaceCondition() {
     std::cout << "  [결과] 크기가 맞지 않거나, 중간에 크래시가 발생할 수 있습니다!\n";
 }
 
+// ============================================================================
+// E: 프레임 스크래치 할당자 (임시 문자열 힙 할당 0회)
+// ============================================================================
+// upstream 할당 횟수를 세는 리소스 (힙 할당 = 이 리소스까지 내려온 할당)
+class CountingResource : public std::pmr::memory_resource {
+    std::pmr::memory_resource* m_Upstream = std::pmr::new_delete_resource();
+public:
+    size_t allocCount = 0;
+
+private:
+    void* do_allocate(size_t bytes, size_t alignment) override {
+        allocCount++;
+        return m_Upstream->allocate(bytes, alignment);
+    }
+    void do_deallocate(void* p, size_t bytes, size_t alignment) override {
+        m_Upstream->deallocate(p, bytes, alignment);
+    }
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+};
+
+// BugA 워커가 ostringstream으로 만들던 것과 같은 로그 한 줄
+void AppendWorkerLogLine(std::pmr::string& out, int threadId, unsigned int errorCode) {
+    char line[80];
+    int len = snprintf(line, sizeof(line), "  Thread %d: Failure with HRESULT of %08X\n",
+                       threadId, errorCode);
+    out.append(line, len);
+}
+
+// 한 프레임 동안 만들어지는 임시 로그 라인들을 모아서 하나로 합침
+size_t BuildFrameLog(std::pmr::memory_resource* resource, int lineCount) {
+    std::pmr::vector<std::pmr::string> lines(resource);
+    lines.reserve(lineCount);
+    for (int i = 0; i < lineCount; i++) {
+        lines.emplace_back();
+        AppendWorkerLogLine(lines.back(), i % 3 + 1, 0x80070005u + i);
+    }
+
+    std::pmr::string joined(resource);
+    for (const auto& line : lines) joined += line;
+    return joined.size();
+}
+
+void DemoFrameScratchAllocator() {
+    std::cout << "\n[E] 프레임 스크래치 할당자 (임시 문자열 힙 할당 0회)\n";
+    std::cout << "  매 프레임 만드는 로그 문자열을 힙 대신 프레임 버퍼에서 할당합니다.\n";
+    std::cout << "  (Debug 빌드에서는 시간 수치가 왜곡되므로 Release에서 측정하세요)\n\n";
+
+    const int FRAMES = 1000;
+    const int LINES_PER_FRAME = 300;
+    size_t checksum = 0;
+
+    // 1) 기존 방식: ostringstream (시간만 측정)
+    auto start = std::chrono::steady_clock::now();
+    for (int f = 0; f < FRAMES; f++) {
+        std::vector<std::string> lines;
+        for (int i = 0; i < LINES_PER_FRAME; i++) {
+            std::ostringstream oss;
+            oss << "  Thread " << (i % 3 + 1) << ": Failure with HRESULT of "
+                << std::hex << std::uppercase << (0x80070005u + i) << "\n";
+            lines.push_back(oss.str());
+        }
+        std::string joined;
+        for (const auto& line : lines) joined += line;
+        checksum += joined.size();
+    }
+    auto end = std::chrono::steady_clock::now();
+    double streamUs = std::chrono::duration<double, std::micro>(end - start).count() / FRAMES;
+
+    // 2) 같은 작업을 힙(new/delete)에서 - 할당 횟수 측정
+    CountingResource heap;
+    start = std::chrono::steady_clock::now();
+    for (int f = 0; f < FRAMES; f++) {
+        checksum += BuildFrameLog(&heap, LINES_PER_FRAME);
+    }
+    end = std::chrono::steady_clock::now();
+    double heapUs = std::chrono::duration<double, std::micro>(end - start).count() / FRAMES;
+    size_t heapAllocsPerFrame = heap.allocCount / FRAMES;
+
+    // 3) 프레임 스크래치 할당자 - 버퍼가 부족할 때만 upstream(heap2)까지 내려감
+    CountingResource heap2;
+    FrameAllocator frame(256 * 1024, &heap2);
+    FrameMemoryResource frameResource(frame);
+    size_t setupAllocs = heap2.allocCount;  // 이중 버퍼 2개 (시작 시 1회)
+
+    start = std::chrono::steady_clock::now();
+    for (int f = 0; f < FRAMES; f++) {
+        checksum += BuildFrameLog(&frameResource, LINES_PER_FRAME);
+        frame.EndFrame();
+    }
+    end = std::chrono::steady_clock::now();
+    double frameUs = std::chrono::duration<double, std::micro>(end - start).count() / FRAMES;
+    size_t frameAllocs = heap2.allocCount - setupAllocs;
+
+    std::cout << "  프레임당 로그 " << LINES_PER_FRAME << "줄, " << FRAMES << "프레임\n\n";
+    std::cout << "  ostringstream        : " << streamUs << " us/프레임\n";
+    std::cout << "  pmr::string (힙)     : " << heapUs << " us/프레임, 힙 할당 "
+              << heapAllocsPerFrame << "회/프레임\n";
+    std::cout << "  pmr::string (프레임) : " << frameUs << " us/프레임, 힙 할당 "
+              << (double)frameAllocs / FRAMES << "회/프레임\n";
+    std::cout << "  프레임 버퍼 최대 사용량: " << frame.PeakUsage() / 1024 << " KB / "
+              << frame.Capacity() / 1024 << " KB\n";
+    std::cout << "  (checksum " << checksum << ")\n";
+
+    // 프레임 태그: 2프레임 전에 할당한 메모리는 이미 리셋됨
+    FrameAllocator::Tagged<char> tagged = frame.AllocateTagged<char>(16);
+    frame.EndFrame();
+    std::cout << "\n  1프레임 뒤 IsAlive = " << frame.IsAlive(tagged.frame);
+    frame.EndFrame();
+    std::cout << ", 2프레임 뒤 IsAlive = " << frame.IsAlive(tagged.frame) << "\n";
+
+    // 버퍼 시작 주소보다 큰 정렬 요청 (SIMD 타입의 pmr::vector 등)도 실제 주소가 정렬되는지
+    bool aligned = true;
+    for (size_t alignment : { 16, 32, 64, 256 }) {
+        frame.Allocate(1, 1);   // 일부러 어긋나게
+        void* p = frameResource.allocate(48, alignment);
+        aligned = aligned && reinterpret_cast<uintptr_t>(p) % alignment == 0;
+    }
+    std::cout << "  16/32/64/256바이트 정렬 요청의 주소가 모두 정렬됨? " << aligned << "\n";
+
+    std::cout << "\n  [결과] " << (aligned ? "" : "정렬 실패! ")
+              << "프레임 버퍼가 충분하면 임시 문자열의 힙 할당이 0회가 됩니다.\n";
+}
+
+// ============================================================================
+// F: 스레드별 메시지 링 + 지연 포맷 (com_exception::what 수정판)
+// ============================================================================
+// threadCount개 스레드를 동시에 출발시켜 fn(threadId)을 실행하고 전체 시간(ms)을 돌려줌
+template <typename Fn>
+double RunThreadsMs(int threadCount, Fn fn) {
+    std::atomic<int> ready(0);
+    std::atomic<bool> go(false);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadCount; t++) {
+        threads.emplace_back([&, t] {
+            ready.fetch_add(1);
+            while (!go.load(std::memory_order_acquire)) std::this_thread::yield();
+            fn(t);
+        });
+    }
+    while (ready.load() < threadCount) std::this_thread::yield();
+
+    auto start = std::chrono::steady_clock::now();
+    go.store(true, std::memory_order_release);
+    for (auto& t : threads) t.join();
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+// 수정판: 에러 코드만 들고 있다가 첫 what()에서 이 스레드의 링에 포맷
+class ThreadSafeComException {
+    unsigned int result;
+public:
+    ThreadSafeComException(unsigned int hr) : result(hr) {}
+
+    const char* what() const noexcept {
+        const uint64_t key = (1ull << 32) | result;  // 상위 32비트: 예외 종류
+        return ThreadMessageRing::Get().GetOrFormat(key, [this](char* buffer, size_t size) {
+            snprintf(buffer, size, "Failure with HRESULT of %08X", result);
+        });
+    }
+};
+
+// 비교용: 공유 버퍼를 mutex로 감싸고, 락 안에서 복사본을 만들어 돌려줌
+class LockedComException {
+    unsigned int result;
+public:
+    LockedComException(unsigned int hr) : result(hr) {}
+
+    std::string what() const {
+        static std::mutex s_mutex;
+        static char s_str[64] = {};
+        std::lock_guard<std::mutex> lock(s_mutex);
+        snprintf(s_str, sizeof(s_str), "Failure with HRESULT of %08X", result);
+        return s_str;
+    }
+};
+
+void BenchmarkThreadMessageRing() {
+    std::cout << "\n[F] 스레드별 메시지 링 + 지연 포맷 (com_exception::what 수정판)\n";
+    std::cout << "  스레드마다 메시지 버퍼를 돌려 쓰고, 문자열은 첫 what()에서 만듭니다.\n";
+    std::cout << "  (Debug 빌드에서는 수치가 크게 왜곡되므로 Release에서 측정하세요)\n\n";
+
+    const int THREADS = 16;
+
+    // 1) BUG A와 비교: 16스레드가 동시에 throw/catch 후 what() 내용 검사
+    const int THROWS = 5000;
+    auto countCorrupted = [&](auto throwAndRead) {
+        std::atomic<int> corrupted(0);
+        RunThreadsMs(THREADS, [&](int t) {
+            char expected[64];
+            for (int i = 0; i < THROWS; i++) {
+                unsigned int hr = 0x80070000u | (unsigned int)(t << 12) | (unsigned int)i;
+                snprintf(expected, sizeof(expected), "Failure with HRESULT of %08X", hr);
+                if (!throwAndRead(hr, expected)) corrupted.fetch_add(1, std::memory_order_relaxed);
+            }
+        });
+        return corrupted.load();
+    };
+    int sharedCorrupted = countCorrupted([](unsigned int hr, const char* expected) {
+        try { throw com_exception(hr); }
+        catch (const com_exception& e) {
+            const char* msg = e.what();
+            std::this_thread::yield();   // 다른 스레드가 끼어들 틈
+            return strcmp(msg, expected) == 0;
+        }
+    });
+    int ringCorrupted = countCorrupted([](unsigned int hr, const char* expected) {
+        try { throw ThreadSafeComException(hr); }
+        catch (const ThreadSafeComException& e) {
+            const char* msg = e.what();
+            std::this_thread::yield();
+            return strcmp(msg, expected) == 0;
+        }
+    });
+    std::cout << "  " << THREADS << "스레드 x throw/catch " << THROWS << "회\n";
+    std::cout << "    static 버퍼 com_exception : 손상된 메시지 " << sharedCorrupted << "건\n";
+    std::cout << "    스레드별 링               : 손상된 메시지 " << ringCorrupted << "건\n\n";
+
+    // 2) what() 처리량: 예외마다 첫 what()은 포맷, 두 번째는 링/락에서 재사용
+    const int CALLS = 200000;
+    const int ROUNDS = 3;
+    double lockedMs = 1e30, ringMs = 1e30;
+    size_t lockedBytes = 0, ringBytes = 0;
+    uint64_t ringFormats = 0;
+    for (int round = 0; round < ROUNDS; round++) {
+        std::atomic<size_t> bytes(0);
+        double ms = RunThreadsMs(THREADS, [&](int t) {
+            size_t local = 0;
+            for (int i = 0; i < CALLS / 2; i++) {
+                LockedComException ex(0x80000000u | (unsigned int)(t << 16) | (unsigned int)i);
+                local += ex.what().size();
+                local += ex.what().size();
+            }
+            bytes.fetch_add(local);
+        });
+        if (ms < lockedMs) lockedMs = ms;
+        lockedBytes = bytes.load();
+
+        std::atomic<size_t> bytes2(0);
+        std::atomic<uint64_t> formats(0);
+        ms = RunThreadsMs(THREADS, [&](int t) {
+            size_t local = 0;
+            uint64_t before = ThreadMessageRing::Get().FormatCount();
+            for (int i = 0; i < CALLS / 2; i++) {
+                ThreadSafeComException ex(0x80000000u | (unsigned int)(t << 16) | (unsigned int)i);
+                local += strlen(ex.what());
+                local += strlen(ex.what());
+            }
+            bytes2.fetch_add(local);
+            formats.fetch_add(ThreadMessageRing::Get().FormatCount() - before);
+        });
+        if (ms < ringMs) ringMs = ms;
+        ringBytes = bytes2.load();
+        ringFormats = formats.load();
+    }
+
+    double totalCalls = (double)THREADS * CALLS;
+    std::cout << "  " << THREADS << "스레드 x what() " << CALLS << "회 (예외당 2회)\n";
+    std::cout << "    mutex + 공유 버퍼 : " << lockedMs << " ms (" << totalCalls / (lockedMs * 1000.0)
+              << " M회/s)\n";
+    std::cout << "    스레드별 링       : " << ringMs << " ms (" << totalCalls / (ringMs * 1000.0)
+              << " M회/s, " << lockedMs / ringMs << "x), 실제 포맷 " << ringFormats << "회\n";
+    std::cout << "    메시지 바이트 합계 " << (lockedBytes == ringBytes ? "일치" : "불일치!") << " ("
+              << ringBytes << ")\n";
+
+    std::cout << "\n  [결과] 스레드마다 버퍼를 따로 두면 락 없이도 메시지가 섞이지 않고, 포맷은 필요할 때 한 번만 합니다.\n";
+}
+
+// ============================================================================
+// G: 캐시 라인 단위로 나눈 ShardedCounter vs std::atomic
+// ============================================================================
+void BenchmarkShardedCounter() {
+    std::cout << "\n[G] 캐시 라인 단위로 나눈 ShardedCounter vs std::atomic\n";
+    std::cout << "  스레드마다 64바이트 슬롯에 따로 더하고, 읽을 때만 합칩니다.\n";
+    std::cout << "  (Debug 빌드에서는 수치가 크게 왜곡되므로 Release에서 측정하세요)\n\n";
+
+    // 1) BUG B와 비교: 같은 4스레드 x 100000회
+    {
+        const int ITERATIONS = 100000;
+        ShardedCounter score;
+        RunThreadsMs(4, [&](int) {
+            for (int i = 0; i < ITERATIONS; i++) score.Increment();
+        });
+        std::cout << "  BUG B → 기대값 " << 4 * ITERATIONS << ", ShardedCounter " << score.Read() << "\n\n";
+    }
+
+    // 2) 스레드 수별 처리량 (스레드마다 같은 횟수 → 총 작업량은 스레드 수에 비례)
+    const int OPS = 1000000;
+    const int ROUNDS = 3;
+    const int threadCounts[] = { 1, 2, 4, 8, 16, 32, 64 };
+    std::cout << "  하드웨어 스레드 " << std::thread::hardware_concurrency() << "개, 스레드당 " << OPS
+              << "회 증가\n";
+    std::cout << "    스레드   std::atomic fetch_add   ShardedCounter        배율   합계\n";
+
+    bool allExact = true;
+    for (int threads : threadCounts) {
+        double atomicMs = 1e30, shardedMs = 1e30;
+        int64_t expected = (int64_t)threads * OPS;
+        bool exact = true;
+        for (int round = 0; round < ROUNDS; round++) {
+            std::atomic<int64_t> atomicScore(0);
+            double ms = RunThreadsMs(threads, [&](int) {
+                for (int i = 0; i < OPS; i++) atomicScore.fetch_add(1, std::memory_order_relaxed);
+            });
+            if (ms < atomicMs) atomicMs = ms;
+
+            ShardedCounter shardedScore;
+            ms = RunThreadsMs(threads, [&](int) {
+                for (int i = 0; i < OPS; i++) shardedScore.Increment();
+            });
+            if (ms < shardedMs) shardedMs = ms;
+
+            exact = exact && atomicScore.load() == expected && shardedScore.Read() == expected;
+        }
+        allExact = allExact && exact;
+
+        double atomicRate = (double)expected / (atomicMs * 1000.0);
+        double shardedRate = (double)expected / (shardedMs * 1000.0);
+        char line[128];
+        snprintf(line, sizeof(line), "    %4d     %8.1f M회/s          %8.1f M회/s     %5.2fx   %s\n",
+                 threads, atomicRate, shardedRate, shardedRate / atomicRate, exact ? "정확" : "불일치!");
+        std::cout << line;
+    }
+
+    std::cout << "\n  [결과] " << (allExact ? "두 방식 모두 값은 정확하지만, " : "값 불일치! ")
+              << "ShardedCounter는 캐시 라인을 공유하지 않아 스레드가 늘어도 증가 비용이 그대로입니다.\n";
+}
+
+// ============================================================================
+// H: 카운터 기반 난수 스트림 (PhiloxRng) vs 스레드별 mt19937
+// ============================================================================
+// BUG C 수정판: 엔티티마다 (seed, 엔티티 ID) 스트림에서 뽑음
+Vector3 PickRandomTarget(PhiloxRng& rng, float range) {
+    float x = rng.NextFloat(-range, range);
+    float z = rng.NextFloat(-range, range);
+    return { x, 0, z };
+}
+
+void BenchmarkPhiloxRng() {
+    std::cout << "\n[H] 카운터 기반 난수 스트림 (PhiloxRng) vs 스레드별 mt19937\n";
+    std::cout << "  (seed, 엔티티)마다 독립 스트림을 만들고, 배치는 SIMD 레인에 나란히 계산합니다.\n";
+    std::cout << "  (Debug 빌드에서는 수치가 크게 왜곡되므로 Release에서 측정하세요)\n\n";
+
+    const uint64_t SEED = 42;
+
+    // 1) BUG C와 비교 + 스레드 수와 무관한 재현성
+    const int ENTITIES = 40000;
+    const int TARGETS = 4;
+    auto runPhilox = [&](int threads, std::vector<Vector3>& out) {
+        out.assign((size_t)ENTITIES * TARGETS, Vector3{});
+        RunThreadsMs(threads, [&](int t) {
+            for (int e = t; e < ENTITIES; e += threads) {
+                PhiloxRng rng(SEED, (uint32_t)e);
+                for (int k = 0; k < TARGETS; k++) out[(size_t)e * TARGETS + k] = PickRandomTarget(rng, 100.0f);
+            }
+        });
+    };
+    auto runMersenne = [&](int threads, std::vector<Vector3>& out) {
+        out.assign((size_t)ENTITIES * TARGETS, Vector3{});
+        RunThreadsMs(threads, [&](int t) {
+            std::mt19937 gen((uint32_t)(SEED + t));
+            std::uniform_real_distribution<float> dist(-100.0f, 100.0f);
+            for (int e = t; e < ENTITIES; e += threads) {
+                for (int k = 0; k < TARGETS; k++) {
+                    float x = dist(gen);
+                    float z = dist(gen);
+                    out[(size_t)e * TARGETS + k] = { x, 0, z };
+                }
+            }
+        });
+    };
+    auto sameTargets = [](const std::vector<Vector3>& a, const std::vector<Vector3>& b) {
+        return memcmp(a.data(), b.data(), a.size() * sizeof(Vector3)) == 0;
+    };
+
+    std::vector<Vector3> philoxBase, mersenneBase, result;
+    runPhilox(1, philoxBase);
+    runMersenne(1, mersenneBase);
+    int abnormal = 0;
+    for (const Vector3& v : philoxBase) {
+        if (!(v.x >= -100.0f && v.x < 100.0f && v.z >= -100.0f && v.z < 100.0f)) abnormal++;
+    }
+    std::cout << "  BUG C → 엔티티 " << ENTITIES << "개 x 목표 " << TARGETS << "개, 비정상 값 " << abnormal << "건\n";
+    std::cout << "  1스레드 결과와 같은가?   PhiloxRng   스레드별 mt19937\n";
+    const int threadCounts[] = { 2, 4, 16 };
+    bool philoxStable = true;
+    for (int threads : threadCounts) {
+        runPhilox(threads, result);
+        bool philoxSame = sameTargets(result, philoxBase);
+        runMersenne(threads, result);
+        bool mersenneSame = sameTargets(result, mersenneBase);
+        philoxStable = philoxStable && philoxSame;
+        char line[96];
+        snprintf(line, sizeof(line), "    %2d스레드               %s        %s\n", threads,
+                 philoxSame ? "같음" : "다름", mersenneSame ? "같음" : "다름");
+        std::cout << line;
+    }
+    std::cout << "\n";
+
+    // 2) 처리량: 스레드마다 float 생성
+    const int THREADS = 4;
+    const size_t FLOATS = 1 << 24;
+    const size_t BATCH = 4096;
+    const int ROUNDS = 3;
+    SimdLevel supported = GetSupportedSimdLevel();
+
+    auto measure = [&](auto generate) {
+        double best = 1e30;
+        double checksum = 0.0;
+        for (int round = 0; round < ROUNDS; round++) {
+            std::atomic<uint64_t> sum(0);
+            double ms = RunThreadsMs(THREADS, [&](int t) {
+                sum.fetch_add(generate(t));
+            });
+            if (ms < best) best = ms;
+            checksum = (double)sum.load();
+        }
+        return std::make_pair(best, checksum);
+    };
+    auto rate = [&](double ms) { return (double)THREADS * FLOATS / (ms * 1000.0); };
+
+    auto mersenne = measure([&](int t) {
+        std::mt19937 gen((uint32_t)(SEED + t));
+        std::uniform_real_distribution<float> dist(0.0f, 1.0f);
+        float sum = 0.0f;
+        for (size_t i = 0; i < FLOATS; i++) sum += dist(gen);
+        return (uint64_t)sum;
+    });
+    auto philoxScalar = measure([&](int t) {
+        PhiloxRng rng(SEED, (uint32_t)t);
+        float sum = 0.0f;
+        for (size_t i = 0; i < FLOATS; i++) sum += rng.NextFloat();
+        return (uint64_t)sum;
+    });
+    std::cout << "  " << THREADS << "스레드 x float " << FLOATS << "개\n";
+    std::cout << "    스레드별 mt19937                 : " << mersenne.first << " ms (" << rate(mersenne.first) << " M개/s)\n";
+    std::cout << "    PhiloxRng::NextFloat             : " << philoxScalar.first << " ms (" << rate(philoxScalar.first)
+              << " M개/s, " << mersenne.first / philoxScalar.first << "x)\n";
+
+    // 배치: 단계별로 같은 스트림을 채우고 결과를 NextFloat와 비교
+    std::vector<float> expected(BATCH);
+    {
+        PhiloxRng rng(SEED, 0);
+        for (float& f : expected) f = rng.NextFloat();
+    }
+    const SimdLevel levels[] = { SimdLevel::Scalar, SimdLevel::SSE41, SimdLevel::AVX2 };
+    bool batchExact = true;
+    for (SimdLevel level : levels) {
+        if (level > supported) continue;
+        SetSimdLevel(level);
+
+        std::vector<float> check(BATCH);
+        PhiloxRng rng(SEED, 0);
+        rng.FillUniform(check.data(), 3);       // 블록 경계가 어긋난 채로 시작해도 같은 순서
+        rng.FillUniform(check.data() + 3, BATCH - 3);
+        bool exact = check == expected;
+        batchExact = batchExact && exact;
+
+        auto batch = measure([&](int t) {
+            PhiloxRng stream(SEED, (uint32_t)t);
+            std::vector<float> buffer(BATCH);
+            float sum = 0.0f;
+            for (size_t i = 0; i < FLOATS; i += BATCH) {
+                stream.FillUniform(buffer.data(), BATCH);
+                sum += buffer[0] + buffer[BATCH - 1];
+            }
+            return (uint64_t)sum;
+        });
+        char name[48];
+        snprintf(name, sizeof(name), "    PhiloxRng::FillUniform %-7s : ", GetSimdLevelName(level));
+        std::cout << name << batch.first << " ms (" << rate(batch.first)
+                  << " M개/s, " << mersenne.first / batch.first << "x), NextFloat와 " << (exact ? "동일" : "다름!") << "\n";
+    }
+    SetSimdLevel(supported);
+
+    std::cout << "\n  [결과] " << (philoxStable && batchExact ? "스레드 수와 SIMD 단계에 상관없이 같은 난수가 나오고, "
+                                                              : "재현성 실패! ")
+              << "공유 상태가 없어 스레드 안전합니다.\n";
+}
+
+// ============================================================================
+// I: lock-free MPSC 링 / 스레드별 추가 블록 vs mutex + vector
+// ============================================================================
+// 값 = threadId * 10000000 + i. 스레드별로 순서가 유지됐는지 검사
+bool CheckPerThreadOrder(const std::vector<int>& log, int threads) {
+    std::vector<int> last(threads, -1);
+    for (int value : log) {
+        int t = value / 10000000;
+        int i = value % 10000000;
+        if (t < 0 || t >= threads || i <= last[t]) return false;
+        last[t] = i;
+    }
+    return true;
+}
+
+void BenchmarkLogQueues() {
+    std::cout << "\n[I] lock-free MPSC 링 / 스레드별 추가 블록 vs mutex + vector\n";
+    std::cout << "  생산자는 락을 잡지 않고, 소비자가 묶음으로 꺼내거나 프레임 끝에 합칩니다.\n";
+    std::cout << "  (Debug 빌드에서는 수치가 크게 왜곡되므로 Release에서 측정하세요)\n";
+    std::cout << "  세 방식이 같은 양을 옮기도록, 링이 꽉 차면 생산자는 버리지 않고 양보 후 다시 넣습니다.\n\n";
+
+    const int ITEMS = 250000;
+    const size_t RING_CAPACITY = 1 << 16;
+    const size_t BATCH = 256;
+    const int ROUNDS = 3;
+    const int threadCounts[] = { 4, 16 };
+
+    bool allValid = true;
+    for (int threads : threadCounts) {
+        const size_t total = (size_t)threads * ITEMS;
+        double mutexMs = 1e30, ringMs = 1e30, frameMs = 1e30;
+        uint64_t ringFullRetries = 0;
+        bool mutexValid = true, ringValid = true, frameValid = true;
+
+        for (int round = 0; round < ROUNDS; round++) {
+            // 1) BUG D의 일반적인 수정: mutex + push_back
+            {
+                std::vector<int> sharedLog;
+                std::mutex logMutex;
+                double ms = RunThreadsMs(threads, [&](int t) {
+                    for (int i = 0; i < ITEMS; i++) {
+                        std::lock_guard<std::mutex> lock(logMutex);
+                        sharedLog.push_back(t * 10000000 + i);
+                    }
+                });
+                if (ms < mutexMs) mutexMs = ms;
+                mutexValid = mutexValid && sharedLog.size() == total && CheckPerThreadOrder(sharedLog, threads);
+            }
+
+            // 2) MpscRing + 소비자 스레드 (마지막 스레드)가 묶음으로 꺼냄
+            {
+                MpscRing<int> ring(RING_CAPACITY);
+                std::vector<int> received;
+                received.reserve(total);
+                std::atomic<int> producersLeft(threads);
+                std::atomic<uint64_t> retries(0);
+                double ms = RunThreadsMs(threads + 1, [&](int t) {
+                    if (t < threads) {
+                        uint64_t localRetries = 0;
+                        for (int i = 0; i < ITEMS; i++) {
+                            // 꽉 차면 소비자에게 양보하고 다시 시도
+                            while (!ring.TryPush(t * 10000000 + i)) {
+                                localRetries++;
+                                std::this_thread::yield();
+                            }
+                        }
+                        retries.fetch_add(localRetries, std::memory_order_relaxed);
+                        producersLeft.fetch_sub(1, std::memory_order_release);
+                        return;
+                    }
+                    int batch[BATCH];
+                    for (;;) {
+                        bool finished = producersLeft.load(std::memory_order_acquire) == 0;
+                        size_t n = ring.PopBatch(batch, BATCH);
+                        received.insert(received.end(), batch, batch + n);
+                        if (n == 0) {
+                            if (finished) break;
+                            std::this_thread::yield();
+                        }
+                    }
+                });
+                if (ms < ringMs) ringMs = ms;
+                ringFullRetries = retries.load(std::memory_order_relaxed);
+                ringValid = ringValid && received.size() == total && CheckPerThreadOrder(received, threads);
+            }
+
+            // 3) FrameAppendLog: 스레드별 블록에 쓰고, 프레임 끝에 합침 (합치는 시간 포함)
+            {
+                FrameAppendLog<int> frameLog;
+                std::vector<int> merged;
+                double ms = RunThreadsMs(threads, [&](int t) {
+                    for (int i = 0; i < ITEMS; i++) frameLog.Append(t * 10000000 + i);
+                });
+                auto start = std::chrono::steady_clock::now();
+                frameLog.MergeInto(merged);
+                auto end = std::chrono::steady_clock::now();
+                ms += std::chrono::duration<double, std::milli>(end - start).count();
+                if (ms < frameMs) frameMs = ms;
+                frameValid = frameValid && merged.size() == total && frameLog.GetDroppedCount() == 0 &&
+                             CheckPerThreadOrder(merged, threads);
+            }
+        }
+        allValid = allValid && mutexValid && ringValid && frameValid;
+
+        auto rate = [&](double ms) { return (double)total / (ms * 1000.0); };
+        std::cout << "  생산자 " << threads << "스레드 x " << ITEMS << "개\n";
+        std::cout << "    mutex + vector       : " << mutexMs << " ms (" << rate(mutexMs) << " M개/s), "
+                  << (mutexValid ? "정상" : "손상!") << "\n";
+        std::cout << "    MpscRing (" << RING_CAPACITY << "칸)   : " << ringMs << " ms (" << rate(ringMs) << " M개/s, "
+                  << mutexMs / ringMs << "x), 꽉 차서 다시 시도 " << ringFullRetries << "회, "
+                  << (ringValid ? "정상" : "손상!") << "\n";
+        std::cout << "    FrameAppendLog       : " << frameMs << " ms (" << rate(frameMs) << " M개/s, "
+                  << mutexMs / frameMs << "x), " << (frameValid ? "정상" : "손상!") << "\n\n";
+    }
+
+    std::cout << "  [결과] " << (allValid ? "세 방식 모두 스레드별 순서를 지키고, " : "검증 실패! ")
+              << "생산자는 락을 기다리지 않습니다 (링은 꽉 찼을 때만 소비자를 기다림).\n";
+}
+
+// ============================================================================
+// J: 작업 훔치기 잡 시스템 vs 작업마다 std::thread
+// ============================================================================
+void BenchmarkJobSystem() {
+    std::cout << "\n[J] 작업 훔치기 잡 시스템 (Chase-Lev 덱, ParallelFor, 잡 카운터)\n";
+    std::cout << "  워커를 한 번만 만들고, 기다리는 메인 스레드도 잡을 실행합니다.\n";
+    std::cout << "  (Debug 빌드에서는 수치가 크게 왜곡되므로 Release에서 측정하세요)\n\n";
+
+    JobSystem jobs;
+    std::cout << "  워커 " << jobs.GetWorkerCount() << "개 + 메인 스레드\n\n";
+
+    auto elapsedMs = [](std::chrono::steady_clock::time_point start) {
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    };
+    bool allValid = true;
+
+    // 1) 잡 하나당 비용: 빈 작업을 잔뜩 만들고 기다림
+    {
+        const int JOB_TASKS = 200000;
+        const int THREAD_TASKS = 2000;     // std::thread는 너무 느려서 개수를 줄여 측정
+        std::atomic<int> done{ 0 };
+
+        auto start = std::chrono::steady_clock::now();
+        JobCounter counter;
+        for (int i = 0; i < JOB_TASKS; i++) {
+            jobs.Spawn(counter, [&done] { done.fetch_add(1, std::memory_order_relaxed); });
+        }
+        jobs.Wait(counter);
+        double jobNs = elapsedMs(start) * 1e6 / JOB_TASKS;
+        bool jobValid = done.load() == JOB_TASKS;
+
+        done = 0;
+        start = std::chrono::steady_clock::now();
+        for (int i = 0; i < THREAD_TASKS; i++) {
+            std::thread([&done] { done.fetch_add(1, std::memory_order_relaxed); }).join();
+        }
+        double threadNs = elapsedMs(start) * 1e6 / THREAD_TASKS;
+        bool threadValid = done.load() == THREAD_TASKS;
+        allValid = allValid && jobValid && threadValid;
+
+        std::cout << "  작업 하나 생성 + 실행 + 완료 대기\n";
+        std::cout << "    std::thread 생성/join : " << threadNs << " ns/작업 (" << THREAD_TASKS << "개)\n";
+        std::cout << "    JobSystem Spawn       : " << jobNs << " ns/작업 (" << JOB_TASKS << "개, "
+                  << threadNs / jobNs << "x), " << (jobValid ? "정상" : "누락!") << "\n\n";
+    }
+
+    // 2) fork/join 지연: 작은 작업 8개를 나눠 주고 모두 끝날 때까지
+    {
+        const int FAN_OUT = 8;
+        const int ROUNDS = 1000;
+        const int THREAD_ROUNDS = 100;
+        std::atomic<int> done{ 0 };
+
+        auto start = std::chrono::steady_clock::now();
+        for (int round = 0; round < ROUNDS; round++) {
+            JobCounter counter;
+            for (int i = 0; i < FAN_OUT; i++) {
+                jobs.Spawn(counter, [&done] { done.fetch_add(1, std::memory_order_relaxed); });
+            }
+            jobs.Wait(counter);
+        }
+        double jobUs = elapsedMs(start) * 1000.0 / ROUNDS;
+        bool jobValid = done.load() == FAN_OUT * ROUNDS;
+
+        done = 0;
+        start = std::chrono::steady_clock::now();
+        for (int round = 0; round < THREAD_ROUNDS; round++) {
+            std::vector<std::thread> threads;
+            for (int i = 0; i < FAN_OUT; i++) {
+                threads.emplace_back([&done] { done.fetch_add(1, std::memory_order_relaxed); });
+            }
+            for (auto& t : threads) t.join();
+        }
+        double threadUs = elapsedMs(start) * 1000.0 / THREAD_ROUNDS;
+        allValid = allValid && jobValid && done.load() == FAN_OUT * THREAD_ROUNDS;
+
+        std::cout << "  fork/join (" << FAN_OUT << "개로 나누고 모두 기다림) 1회\n";
+        std::cout << "    std::thread x " << FAN_OUT << "       : " << threadUs << " us\n";
+        std::cout << "    JobSystem             : " << jobUs << " us (" << threadUs / jobUs << "x), "
+                  << (jobValid ? "정상" : "누락!") << "\n\n";
+    }
+
+    // 3) ParallelFor: 잡 크기(grainSize)에 따른 비용
+    {
+        const size_t COUNT = 1 << 22;
+        std::vector<uint32_t> values(COUNT);
+        for (size_t i = 0; i < COUNT; i++) values[i] = (uint32_t)(i * 2654435761u) >> 20;
+
+        auto start = std::chrono::steady_clock::now();
+        uint64_t expected = 0;
+        for (uint32_t v : values) expected += v;
+        double serialMs = elapsedMs(start);
+
+        std::cout << "  ParallelFor 합계 (" << COUNT << "개, 직렬 " << serialMs << " ms)\n";
+        const size_t grains[] = { 256, 4096, 65536, 1 << 20 };
+        for (size_t grain : grains) {
+            ShardedCounter total;
+            start = std::chrono::steady_clock::now();
+            jobs.ParallelFor(0, COUNT, grain, [&](size_t first, size_t last) {
+                uint64_t sum = 0;
+                for (size_t i = first; i < last; i++) sum += values[i];
+                total.Add((int64_t)sum);
+            });
+            double ms = elapsedMs(start);
+            bool valid = (uint64_t)total.Read() == expected;
+            allValid = allValid && valid;
+
+            char line[128];
+            std::snprintf(line, sizeof(line), "    grain %8zu : 잡 %6zu개, %8.3f ms, %s\n", grain,
+                          (COUNT + grain - 1) / grain, ms, valid ? "정상" : "합계 틀림!");
+            std::cout << line;
+        }
+        std::cout << "\n";
+    }
+
+    // 4) 의존성: 물리 잡이 모두 끝난 뒤에만 애니메이션 잡 실행
+    {
+        const int BODIES = 64;
+        const int FRAMES = 200;
+        std::vector<int> positions(BODIES, 0);
+        bool sawCompleteFrame = true;
+
+        for (int frame = 1; frame <= FRAMES; frame++) {
+            JobCounter physics;
+            JobCounter animation;
+            for (int i = 0; i < BODIES; i++) {
+                jobs.Spawn(physics, [&positions, i, frame] { positions[i] = frame; });
+            }
+            jobs.RunAfter(physics, jobs.Create(animation, [&positions, &sawCompleteFrame, frame] {
+                for (int p : positions) {
+                    if (p != frame) sawCompleteFrame = false;
+                }
+            }));
+            jobs.Wait(animation);
+        }
+        allValid = allValid && sawCompleteFrame;
+
+        std::cout << "  RunAfter 의존성 (물리 " << BODIES << "개 → 애니메이션 1개) x " << FRAMES << "프레임: "
+                  << (sawCompleteFrame ? "애니메이션이 항상 완성된 물리 결과를 봄" : "미완성 결과를 봄!") << "\n";
+        std::cout << "  다른 덱에서 훔친 잡: " << jobs.GetStealCount() << "개\n\n";
+    }
+
+    std::cout << "  [결과] " << (allValid ? "모든 잡이 한 번씩 실행됐고, " : "검증 실패! ")
+              << "스레드를 다시 만들지 않아 작은 작업도 나눌 수 있습니다.\n";
+}
+
+// ============================================================================
+// K: 비동기 로거 (스레드별 SPSC 링 + 출력 스레드) vs ostringstream + 줄마다 출력
+// ============================================================================
+// "[T<번호>] worker <t> line <i>: Failure with HRESULT of <hex>" 줄을 검사
+bool CheckLoggedLines(std::FILE* file, int threads, int linesPerThread, uint64_t dropped) {
+    std::rewind(file);
+    std::vector<int> last(threads, -1);
+    char line[256];
+    uint64_t count = 0;
+    while (std::fgets(line, sizeof(line), file)) {
+        unsigned index = 0, hr = 0;
+        int t = -1, i = -1;
+        if (std::sscanf(line, "[T%u] worker %d line %d: Failure with HRESULT of %X", &index, &t, &i, &hr) != 4) {
+            return false;
+        }
+        if (t < 0 || t >= threads || i <= last[t] || hr != 0x80070000u + (unsigned)i) return false;
+        last[t] = i;
+        count++;
+    }
+    return count + dropped == (uint64_t)threads * linesPerThread;
+}
+
+void BenchmarkAsyncLogger() {
+    std::cout << "\n[K] 비동기 로거 (스레드별 SPSC 링 + 출력 스레드) vs ostringstream + 줄마다 출력\n";
+    std::cout << "  호출한 스레드는 포맷 ID와 인자만 링에 넣고, 포맷/출력은 로거 스레드가 묶어서 합니다.\n";
+    std::cout << "  (Debug 빌드에서는 수치가 크게 왜곡되므로 Release에서 측정하세요)\n\n";
+
+    // BUG A와 같은 로그를 콘솔로
+    {
+        AsyncLogger consoleLog(stdout);
+        std::vector<std::thread> threads;
+        const unsigned int codes[] = { 0x80070005, 0x80004001, 0x8000FFFF };
+        for (int t = 0; t < 3; t++) {
+            threads.emplace_back([&consoleLog, t, &codes] {
+                for (int i = 0; i < 2; i++) {
+                    consoleLog.Log(FIXED_FMT("Thread {}: Failure with HRESULT of {:X}"), t + 1, codes[t]);
+                }
+            });
+        }
+        for (auto& t : threads) t.join();
+        consoleLog.Flush();
+        std::cout << "\n";
+    }
+
+    const int LINES = 20000;
+    const int BURST = 100;      // 이만큼씩 묶어 재고 중앙값을 씀 (선점된 묶음은 걸러짐)
+    bool allValid = true;
+    bool anyDropped = false;
+
+    // 스레드마다 logLine(t, i)를 LINES번 부르고, 한 줄당 시간(ns)의 중앙값을 돌려줌
+    auto measure = [&](int threads, auto logLine) {
+        std::vector<std::vector<double>> samples(threads);
+        RunThreadsMs(threads, [&](int t) {
+            for (int i = 0; i < LINES; i += BURST) {
+                auto start = std::chrono::steady_clock::now();
+                for (int j = i; j < i + BURST; j++) logLine(t, j);
+                auto end = std::chrono::steady_clock::now();
+                samples[t].push_back(std::chrono::duration<double, std::nano>(end - start).count() / BURST);
+            }
+        });
+        std::vector<double> all;
+        for (auto& s : samples) all.insert(all.end(), s.begin(), s.end());
+        std::nth_element(all.begin(), all.begin() + all.size() / 2, all.end());
+        return all[all.size() / 2];
+    };
+
+    for (int threads : { 1, 4 }) {
+        const uint64_t total = (uint64_t)threads * LINES;
+
+        // 1) 지금 방식: 줄마다 ostringstream으로 만들고, FILE 락을 잡고 쓰고 내보냄 (콘솔의 std::cout과 같음)
+        double streamNs;
+        bool streamValid;
+        {
+            std::FILE* file = std::tmpfile();
+            streamNs = measure(threads, [&](int t, int i) {
+                std::ostringstream oss;
+                oss << "[T0] worker " << t << " line " << i << ": Failure with HRESULT of " << std::hex
+                    << std::uppercase << std::setw(8) << std::setfill('0') << (0x80070000u + i) << "\n";
+                std::fputs(oss.str().c_str(), file);
+                std::fflush(file);
+            });
+            streamValid = CheckLoggedLines(file, threads, LINES, 0);
+            std::fclose(file);
+        }
+
+        // 2) AsyncLogger: 호출 스레드가 쓰는 시간 + 모두 파일에 쓰일 때까지 기다린 시간
+        double loggerNs, flushMs;
+        uint64_t dropped, writes;
+        bool loggerValid;
+        {
+            std::FILE* file = std::tmpfile();
+            {
+                AsyncLogger logger(file, 1 << 16);
+                loggerNs = measure(threads, [&](int t, int i) {
+                    logger.Log(FIXED_FMT("worker {} line {}: Failure with HRESULT of {:X}"), t, i, 0x80070000u + i);
+                });
+                auto start = std::chrono::steady_clock::now();
+                logger.Flush();
+                flushMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+                dropped = logger.GetDroppedCount();
+                writes = logger.GetWriteCount();
+            }
+            loggerValid = CheckLoggedLines(file, threads, LINES, dropped);
+            std::fclose(file);
+        }
+        allValid = allValid && streamValid && loggerValid;
+        anyDropped = anyDropped || dropped > 0;
+
+        char line[192];
+        std::cout << "  " << threads << "스레드 x " << LINES << "줄 (호출한 스레드에서 한 줄에 걸린 시간, 중앙값)\n";
+        std::snprintf(line, sizeof(line), "    ostringstream + 줄마다 출력 : %8.1f ns/줄, write %llu회, %s\n", streamNs,
+                      (unsigned long long)total, streamValid ? "정상" : "손상!");
+        std::cout << line;
+        std::snprintf(line, sizeof(line),
+                      "    AsyncLogger::Log            : %8.1f ns/줄 (%.1fx), write %llu회, 버림 %llu줄, %s\n",
+                      loggerNs, streamNs / loggerNs, (unsigned long long)writes, (unsigned long long)dropped,
+                      loggerValid ? "정상" : "손상!");
+        std::cout << line;
+        std::snprintf(line, sizeof(line), "    (그 뒤 Flush()로 남은 줄이 모두 쓰일 때까지 %.2f ms)\n\n", flushMs);
+        std::cout << line;
+    }
+
+    if (anyDropped) {
+        std::cout << "  ※ 출력 스레드가 CPU를 얻지 못하는 동안 링이 차면 생산자는 기다리지 않고 버립니다.\n"
+                  << "    (코어가 적을수록 잘 일어남. 링 크기를 늘리거나 Flush 주기를 짧게 하세요)\n\n";
+    }
+
+    std::cout << "  [결과] " << (allValid ? "모든 줄이 스레드별 순서대로 온전히 기록됐고, " : "검증 실패! ")
+              << "호출한 스레드는 락과 시스템 호출 없이 돌아옵니다.\n";
+}
+
 // ============================================================================
 // 메인
 // ============================================================================
@@ -173,6 +1065,13 @@ int main() {
     std::cout << "  [B] 공유 카운터 동기화 없음 (값 손실)\n";
     std::cout << "  [C] static 랜덤 엔진 (내부 상태 손상)\n";
     std::cout << "  [D] 벡터 동시 push_back (데이터 레이스)\n";
+    std::cout << "  [E] 프레임 스크래치 할당자 (임시 문자열 힙 할당 0회)\n";
+    std::cout << "  [F] 스레드별 메시지 링 + 지연 포맷 (com_exception::what 수정판)\n";
+    std::cout << "  [G] 캐시 라인 단위로 나눈 ShardedCounter vs std::atomic\n";
+    std::cout << "  [H] 카운터 기반 난수 스트림 (PhiloxRng) vs 스레드별 mt19937\n";
+    std::cout << "  [I] lock-free MPSC 링 / 스레드별 추가 블록 vs mutex + vector\n";
+    std::cout << "  [J] 작업 훔치기 잡 시스템 (Chase-Lev 덱, ParallelFor, 잡 카운터)\n";
+    std::cout << "  [K] 비동기 로거 (스레드별 SPSC 링 + 출력 스레드) vs ostringstream + 줄마다 출력\n";
     std::cout << "  [Q] 종료\n";
     std::cout << "----------------------------------------------------\n";
 
@@ -187,6 +1086,13 @@ int main() {
         case 'B': BugB_SharedCounterNoSync(); break;
         case 'C': BugC_StaticRandomEngine(); break;
         case 'D': BugD_VectorRaceCondition(); break;
+        case 'E': DemoFrameScratchAllocator(); break;
+        case 'F': BenchmarkThreadMessageRing(); break;
+        case 'G': BenchmarkShardedCounter(); break;
+        case 'H': BenchmarkPhiloxRng(); break;
+        case 'I': BenchmarkLogQueues(); break;
+        case 'J': BenchmarkJobSystem(); break;
+        case 'K': BenchmarkAsyncLogger(); break;
         case 'Q': std::cout << "종료합니다.\n"; return 0;
         default:  std::cout << "잘못된 입력입니다.\n"; break;
         }
@@ -31,6 +31,9 @@
 
 #pragma comment(lib, "DbgHelp.lib")
 
+#include "FixedFormat.h"
+#include "SafeFilename.h"
+
 // BuildInfo.h - Pre-Build Event에서 자동 생성됨
 // Git revision, branch, 빌드 타임스탬프 정보를 담고 있습니다.
 #include "BuildInfo.h"
@@ -105,34 +108,15 @@ bool WriteMiniDump(EXCEPTION_POINTERS* pExInfo, const wchar_t* filename)
 
 // 브랜치명에 '/' 등 파일명에 쓸 수 없는 문자를 '_'로 치환
 // 예: "claude/infallible-dubinsky" → "claude_infallible-dubinsky"
+// SafeFilename의 SIMD 커널로 16/32글자씩 분류해서 치환
 void MakeSafeFilename(char* dst, size_t dstSize, const char* src)
 {
-    size_t i = 0;
-    for (; i < dstSize - 1 && src[i] != '\0'; ++i)
-    {
-        char c = src[i];
-        if (c == '/' || c == '\\' || c == ':' || c == '*' ||
-            c == '?' || c == '"'  || c == '<' || c == '>' || c == '|')
-            dst[i] = '_';
-        else
-            dst[i] = c;
-    }
-    dst[i] = '\0';
+    SafeFilename::Copy(dst, dstSize, src);
 }
 
 void MakeSafeFilenameW(wchar_t* dst, size_t dstSize, const wchar_t* src)
 {
-    size_t i = 0;
-    for (; i < dstSize - 1 && src[i] != L'\0'; ++i)
-    {
-        wchar_t c = src[i];
-        if (c == L'/' || c == L'\\' || c == L':' || c == L'*' ||
-            c == L'?' || c == L'"'  || c == L'<' || c == L'>' || c == L'|')
-            dst[i] = L'_';
-        else
-            dst[i] = c;
-    }
-    dst[i] = L'\0';
+    SafeFilename::Copy(dst, dstSize, src);
 }
 
 // SEH 예외 코드를 문자열로 변환
@@ -163,15 +147,13 @@ bool PrintCrashMessage(EXCEPTION_POINTERS* pExInfo, bool bAskDump = false)
     DWORD code = pRecord->ExceptionCode;
 
     // MessageBox용 문자열 조립
-    char msgBuf[1024];
-    int pos = 0;
+    // 크래시 처리 중이므로 힙을 쓰지 않고, 넘치면 sprintf_s처럼 중단하지 않고 잘라냄
+    FixedString<1024> msgBuf;
 
-    pos += sprintf_s(msgBuf + pos, sizeof(msgBuf) - pos,
-        "[ CRASH ]\n\nCode: %s\n", GetExceptionCodeString(code));
+    msgBuf.Append(FIXED_FMT("[ CRASH ]\n\nCode: {}\n"), GetExceptionCodeString(code));
 
-    pos += sprintf_s(msgBuf + pos, sizeof(msgBuf) - pos,
-        "Address: 0x%llX\n",
-        reinterpret_cast<unsigned long long>(pRecord->ExceptionAddress));
+    msgBuf.Append(FIXED_FMT("Address: 0x{:X}\n"),
+        reinterpret_cast<uintptr_t>(pRecord->ExceptionAddress));
 
     // 콘솔 출력
     std::cout << "  ┌─── Crash Info ───────────────────────────────┐\n";
@@ -193,8 +175,7 @@ bool PrintCrashMessage(EXCEPTION_POINTERS* pExInfo, bool bAskDump = false)
         if (rwFlag == 1) action = "Write";
         else if (rwFlag == 8) action = "DEP Execute";
 
-        pos += sprintf_s(msgBuf + pos, sizeof(msgBuf) - pos,
-            "\n%s at 0x%llX\n", action, static_cast<unsigned long long>(target));
+        msgBuf.Append(FIXED_FMT("\n{} at 0x{:X}\n"), action, target);
 
         std::cout << "  │ 원인:    0x" << std::hex << target << std::dec
                   << " 주소에 " << (rwFlag == 0 ? "읽기" : rwFlag == 1 ? "쓰기" : "DEP 실행") << " 시도\n";
@@ -243,8 +224,7 @@ bool PrintCrashMessage(EXCEPTION_POINTERS* pExInfo, bool bAskDump = false)
 
     if (diagnosis[0] != '\0')
     {
-        pos += sprintf_s(msgBuf + pos, sizeof(msgBuf) - pos,
-            "\nDiagnosis:\n%s\n", diagnosis);
+        msgBuf.Append(FIXED_FMT("\nDiagnosis:\n{}\n"), diagnosis);
     }
 
     // 레지스터 정보 (x64)
@@ -253,13 +233,11 @@ bool PrintCrashMessage(EXCEPTION_POINTERS* pExInfo, bool bAskDump = false)
     std::cout << "  │ RSP:     0x" << std::hex << pCtx->Rsp << std::dec << "\n";
     std::cout << "  │ RBP:     0x" << std::hex << pCtx->Rbp << std::dec << "\n";
 
-    pos += sprintf_s(msgBuf + pos, sizeof(msgBuf) - pos,
-        "\nRIP: 0x%llX\nRSP: 0x%llX\nRBP: 0x%llX\n",
+    msgBuf.Append(FIXED_FMT("\nRIP: 0x{:X}\nRSP: 0x{:X}\nRBP: 0x{:X}\n"),
         pCtx->Rip, pCtx->Rsp, pCtx->Rbp);
 #endif
 
-    pos += sprintf_s(msgBuf + pos, sizeof(msgBuf) - pos,
-        "\nBuild: %s (%s)", BUILD_GIT_REVISION, BUILD_GIT_BRANCH);
+    msgBuf.Append(FIXED_FMT("\nBuild: {} ({})"), BUILD_GIT_REVISION, BUILD_GIT_BRANCH);
 
     std::cout << "  │ Build:   " << BUILD_GIT_REVISION << " (" << BUILD_GIT_BRANCH << ")\n";
     std::cout << "  └──────────────────────────────────────────────┘\n";
@@ -268,13 +246,12 @@ bool PrintCrashMessage(EXCEPTION_POINTERS* pExInfo, bool bAskDump = false)
     if (bAskDump)
     {
         // 덤프 질문을 메시지 끝에 추가
-        char fullMsg[1280];
-        sprintf_s(fullMsg, sizeof(fullMsg),
-            "%s\n\n──────────────────────\nCrash dump를 저장하시겠습니까?", msgBuf);
+        FixedString<1280> fullMsg = Format<1280>(
+            FIXED_FMT("{}\n\n──────────────────────\nCrash dump를 저장하시겠습니까?"), msgBuf.c_str());
 
         int result = MessageBoxA(
             NULL,
-            fullMsg,
+            fullMsg.c_str(),
             "ZeroCrashLab - Crash Detected",
             MB_YESNO | MB_ICONERROR | MB_TOPMOST
         );
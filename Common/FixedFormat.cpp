@@ -0,0 +1,126 @@
+/*============================================================================
+ *  FixedFormat.cpp - 숫자 → 문자 변환 (2자리 표, 16진수 표)
+ *============================================================================*/
+#include "FixedFormat.h"
+
+#include <cmath>
+
+namespace {
+
+// "00" "01" ... "99" - 나눗셈 한 번에 두 자리씩
+constexpr char kDigitPairs[] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+constexpr uint64_t kPowersOf10[] = {
+    1ull, 10ull, 100ull, 1000ull, 10000ull, 100000ull, 1000000ull, 10000000ull,
+    100000000ull, 1000000000ull,
+};
+
+// value를 end 바로 앞부터 거꾸로 씀. 시작 위치를 돌려줌
+char* WriteDigitsBackward(uint64_t value, char* end) {
+    char* p = end;
+    while (value >= 100) {
+        unsigned pair = (unsigned)(value % 100) * 2;
+        value /= 100;
+        p -= 2;
+        p[0] = kDigitPairs[pair];
+        p[1] = kDigitPairs[pair + 1];
+    }
+    if (value >= 10) {
+        unsigned pair = (unsigned)value * 2;
+        p -= 2;
+        p[0] = kDigitPairs[pair];
+        p[1] = kDigitPairs[pair + 1];
+    } else {
+        *--p = (char)('0' + value);
+    }
+    return p;
+}
+
+} // namespace
+
+void FormatBuffer::AppendDecimal(uint64_t value, bool negative) {
+    char digits[21];
+    char* end = digits + sizeof(digits);
+    char* begin = WriteDigitsBackward(value, end);
+    if (negative) *--begin = '-';
+    Append(begin, (size_t)(end - begin));
+}
+
+void FormatBuffer::AppendHex(uint64_t value, bool upper) {
+    const char* table = upper ? "0123456789ABCDEF" : "0123456789abcdef";
+    char digits[16];
+    char* end = digits + sizeof(digits);
+    char* p = end;
+    do {
+        *--p = table[value & 0xF];
+        value >>= 4;
+    } while (value);
+    Append(p, (size_t)(end - p));
+}
+
+void FormatBuffer::AppendFloat(double value, int precision) {
+    if (std::isnan(value)) {
+        Append("nan", 3);
+        return;
+    }
+    if (std::signbit(value)) {
+        AppendChar('-');
+        value = -value;
+    }
+    if (std::isinf(value)) {
+        Append("inf", 3);
+        return;
+    }
+
+    // 아주 큰 값은 d.ddde+XX (정수부가 uint64_t를 넘지 않게)
+    int exponent = 0;
+    if (value >= 1e15) {
+        exponent = (int)std::floor(std::log10(value));
+        value /= std::pow(10.0, exponent);
+        if (value >= 10.0) {
+            value /= 10.0;
+            exponent++;
+        }
+    }
+
+    uint64_t scale = kPowersOf10[precision];
+    uint64_t integer = (uint64_t)value;
+    uint64_t fraction = (uint64_t)((value - (double)integer) * (double)scale + 0.5);
+    if (fraction >= scale) {
+        integer++;
+        fraction -= scale;
+        if (exponent != 0 && integer == 10) {   // 9.99..e+X → 1.00..e+(X+1)
+            integer = 1;
+            exponent++;
+        }
+    }
+
+    char digits[48];
+    char* end = digits + sizeof(digits);
+    char* p = end;
+    if (precision > 0) {
+        char* fractionBegin = WriteDigitsBackward(fraction, p);
+        while (p - fractionBegin < precision) *--fractionBegin = '0';
+        p = fractionBegin;
+        *--p = '.';
+    }
+    p = WriteDigitsBackward(integer, p);
+    Append(p, (size_t)(end - p));
+
+    if (exponent != 0) {
+        Append(exponent < 0 ? "e-" : "e+", 2);
+        int magnitude = exponent < 0 ? -exponent : exponent;
+        if (magnitude < 10) AppendChar('0');
+        AppendDecimal((uint64_t)magnitude, false);
+    }
+}
@@ -0,0 +1,340 @@
+/*============================================================================
+ *  FixedFormat - 컴파일 시간 검사 + 고정 크기 버퍼 + 할당 없는 문자열 포맷
+ *  ---------------------------------------------------------------------------
+ *  07_BufferOverflow의 BUG D("Bone index: " + 5)와 BUG E(32바이트 버퍼에 strcat_s)는 모두
+ *  "문자열 만들기"를 포인터 산술과 크기 계산에 맡겨서 생긴 문제입니다.
+ *  sprintf 계열은 형식 문자열과 인자가 맞는지 실행해 봐야 알고,
+ *  iostream은 안전하지만 느리고 힙을 씁니다.
+ *
+ *  FixedFormat은
+ *  - 형식 문자열을 컴파일 시간에 해석합니다. {} 개수와 인자 수가 다르거나,
+ *    {:x}에 float을 넘기는 등 맞지 않으면 컴파일 오류(static_assert)입니다.
+ *  - 호출 측이 준 고정 크기 버퍼(스택 배열, FixedString<N>)에만 씁니다.
+ *    공간이 모자라면 잘라내고 IsTruncated()가 true가 되며, 항상 '\0'으로 끝납니다.
+ *  - 힙 할당, 로케일 조회가 없습니다.
+ *
+ *      FixedString<128> msg;
+ *      msg.Append(FIXED_FMT("Bone index: {} ({:.2}, 0x{:X})"), boneIndex, weight, address);
+ *
+ *      char buf[64];
+ *      FormatTo(buf, FIXED_FMT("{} / {}"), a, b);     // 배열 크기는 자동으로 전달
+ *
+ *  자리 표시자:
+ *      {}     기본 (정수: 10진수, 실수: 소수점 6자리, bool: true/false, 포인터: 0x16진수)
+ *      {:x}   16진수 소문자 (정수, 포인터)
+ *      {:X}   16진수 대문자 (정수, 포인터)
+ *      {:.N}  실수 소수점 N자리 (N = 0~9)
+ *      {{ }}  중괄호 문자 그대로
+ *
+ *  실수는 정수부 + 반올림한 소수부로 찍으므로 printf와 마지막 자리가 다를 수 있습니다
+ *  (절댓값 1e15 이상은 지수 표기). 로그/오류 메시지용입니다.
+ *============================================================================*/
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+// 형식 문자열 리터럴을 타입으로 감싸서 컴파일 시간에 읽을 수 있게 함
+#define FIXED_FMT(literal)                                                          \
+    [] {                                                                            \
+        struct FormatLiteral {                                                      \
+            static constexpr const char* Get() { return literal; }                  \
+            static constexpr size_t Length() { return sizeof(literal) - 1; }        \
+        };                                                                          \
+        return FormatLiteral{};                                                     \
+    }()
+
+// 외부 char 배열에 이어 쓰는 뷰 (capacity는 '\0' 포함, 1 이상)
+class FormatBuffer {
+public:
+    FormatBuffer(char* data, size_t capacity, size_t length = 0)
+        : m_Data(data), m_Capacity(capacity), m_Length(length), m_Truncated(false) {
+        m_Data[m_Length] = '\0';
+    }
+
+    void Append(const char* text, size_t count) {
+        size_t room = m_Capacity - 1 - m_Length;
+        if (count > room) {
+            count = room;
+            m_Truncated = true;
+        }
+        memcpy(m_Data + m_Length, text, count);
+        m_Length += count;
+        m_Data[m_Length] = '\0';
+    }
+
+    void AppendChar(char c) { Append(&c, 1); }
+    void AppendString(const char* text) { Append(text, text ? strlen(text) : 0); }
+
+    void AppendDecimal(uint64_t value, bool negative);
+    void AppendHex(uint64_t value, bool upper);
+    void AppendFloat(double value, int precision);
+
+    const char* c_str() const { return m_Data; }
+    size_t Length() const { return m_Length; }
+    bool IsTruncated() const { return m_Truncated; }
+
+private:
+    char*  m_Data;
+    size_t m_Capacity;
+    size_t m_Length;
+    bool   m_Truncated;
+};
+
+namespace FixedFormatDetail {
+
+enum class SpecKind : uint8_t {
+    Default,
+    Hex,
+    HexUpper,
+    Precision,
+};
+
+// 리터럴 조각 + (있으면) 뒤따르는 인자 하나
+struct Piece {
+    size_t   literalBegin = 0;
+    size_t   literalLength = 0;
+    int      argIndex = -1;         // -1 = 리터럴만
+    SpecKind kind = SpecKind::Default;
+    int      precision = 6;
+};
+
+template <size_t Count>
+struct ParsedFormat {
+    Piece pieces[Count] = {};
+    int   argCount = 0;
+};
+
+// 조각 수를 돌려줌 (out이 있으면 채움). 형식이 잘못되면 -1
+constexpr int ScanFormat(const char* s, size_t length, Piece* out, int* argCount) {
+    int count = 0;
+    int args = 0;
+    size_t start = 0;
+    size_t i = 0;
+    while (i < length) {
+        char c = s[i];
+        if (c == '}') {
+            if (i + 1 >= length || s[i + 1] != '}') return -1;     // 짝 없는 '}'
+            if (out) {
+                out[count].literalBegin = start;
+                out[count].literalLength = i + 1 - start;
+            }
+            count++;
+            i += 2;
+            start = i;
+            continue;
+        }
+        if (c != '{') {
+            i++;
+            continue;
+        }
+        if (i + 1 < length && s[i + 1] == '{') {                    // "{{" → '{'
+            if (out) {
+                out[count].literalBegin = start;
+                out[count].literalLength = i + 1 - start;
+            }
+            count++;
+            i += 2;
+            start = i;
+            continue;
+        }
+
+        // 자리 표시자: {} {:x} {:X} {:.N}
+        size_t close = i + 1;
+        while (close < length && s[close] != '}' && s[close] != '{') close++;
+        if (close >= length || s[close] != '}') return -1;
+
+        SpecKind kind = SpecKind::Default;
+        int precision = 6;
+        size_t specLength = close - (i + 1);
+        const char* spec = s + i + 1;
+        if (specLength == 2 && spec[0] == ':' && spec[1] == 'x') {
+            kind = SpecKind::Hex;
+        } else if (specLength == 2 && spec[0] == ':' && spec[1] == 'X') {
+            kind = SpecKind::HexUpper;
+        } else if (specLength == 3 && spec[0] == ':' && spec[1] == '.' && spec[2] >= '0' && spec[2] <= '9') {
+            kind = SpecKind::Precision;
+            precision = spec[2] - '0';
+        } else if (specLength != 0) {
+            return -1;
+        }
+
+        if (out) {
+            out[count].literalBegin = start;
+            out[count].literalLength = i - start;
+            out[count].argIndex = args;
+            out[count].kind = kind;
+            out[count].precision = precision;
+        }
+        count++;
+        args++;
+        i = close + 1;
+        start = i;
+    }
+
+    // 마지막 리터럴 (비어 있을 수 있음)
+    if (out) {
+        out[count].literalBegin = start;
+        out[count].literalLength = length - start;
+    }
+    count++;
+    if (argCount) *argCount = args;
+    return count;
+}
+
+template <size_t Count>
+constexpr ParsedFormat<Count> ParseFormat(const char* s, size_t length) {
+    ParsedFormat<Count> parsed;
+    ScanFormat(s, length, parsed.pieces, &parsed.argCount);
+    return parsed;
+}
+
+template <typename Fmt>
+struct Parsed {
+    static constexpr int kPieceCount = ScanFormat(Fmt::Get(), Fmt::Length(), nullptr, nullptr);
+    static_assert(kPieceCount > 0, "형식 문자열 오류: 중괄호 짝이 맞지 않거나 지원하지 않는 {:...}");
+    static constexpr ParsedFormat<(kPieceCount > 0 ? kPieceCount : 1)> value =
+        ParseFormat<(kPieceCount > 0 ? kPieceCount : 1)>(Fmt::Get(), Fmt::Length());
+};
+
+template <typename T>
+struct AlwaysFalse : std::false_type {};
+
+template <typename T>
+constexpr bool IsStringArg =
+    std::is_same_v<T, const char*> || std::is_same_v<T, char*> ||
+    std::is_same_v<T, std::string_view> || std::is_same_v<T, std::string>;
+
+template <typename T>
+constexpr bool IsIntegerArg =
+    std::is_integral_v<T> && !std::is_same_v<T, bool> && !std::is_same_v<T, char>;
+
+template <SpecKind Kind, int Precision, typename T>
+void WriteArg(FormatBuffer& buffer, const T& value) {
+    if constexpr (std::is_same_v<T, bool>) {
+        static_assert(Kind == SpecKind::Default, "bool에는 {}만 쓸 수 있습니다");
+        if (value) buffer.Append("true", 4);
+        else       buffer.Append("false", 5);
+    } else if constexpr (std::is_same_v<T, char>) {
+        static_assert(Kind == SpecKind::Default, "char에는 {}만 쓸 수 있습니다");
+        buffer.AppendChar(value);
+    } else if constexpr (IsIntegerArg<T>) {
+        static_assert(Kind != SpecKind::Precision, "{:.N}은 실수 전용입니다");
+        if constexpr (Kind == SpecKind::Default) {
+            if constexpr (std::is_signed_v<T>) {
+                uint64_t magnitude = value < 0 ? 0 - (uint64_t)(int64_t)value : (uint64_t)value;
+                buffer.AppendDecimal(magnitude, value < 0);
+            } else {
+                buffer.AppendDecimal((uint64_t)value, false);
+            }
+        } else {
+            // 음수는 printf의 %x처럼 같은 크기의 부호 없는 값으로
+            using Unsigned = std::make_unsigned_t<T>;
+            buffer.AppendHex((uint64_t)(Unsigned)value, Kind == SpecKind::HexUpper);
+        }
+    } else if constexpr (std::is_floating_point_v<T>) {
+        static_assert(Kind == SpecKind::Default || Kind == SpecKind::Precision,
+                      "실수에는 {} 또는 {:.N}만 쓸 수 있습니다");
+        buffer.AppendFloat((double)value, Precision);
+    } else if constexpr (IsStringArg<T>) {
+        static_assert(Kind == SpecKind::Default, "문자열에는 {}만 쓸 수 있습니다");
+        if constexpr (std::is_same_v<T, std::string_view> || std::is_same_v<T, std::string>) {
+            buffer.Append(value.data(), value.size());
+        } else {
+            buffer.AppendString(value ? value : "(null)");
+        }
+    } else if constexpr (std::is_pointer_v<T> || std::is_null_pointer_v<T>) {
+        static_assert(Kind != SpecKind::Precision, "{:.N}은 실수 전용입니다");
+        buffer.Append("0x", 2);
+        buffer.AppendHex((uint64_t)(uintptr_t)value, Kind == SpecKind::HexUpper);
+    } else {
+        static_assert(AlwaysFalse<T>::value, "FixedFormat이 지원하지 않는 인자 형식입니다");
+    }
+}
+
+template <typename Fmt, size_t I, typename Tuple>
+void WritePiece(FormatBuffer& buffer, const Tuple& args) {
+    constexpr Piece piece = Parsed<Fmt>::value.pieces[I];
+    if constexpr (piece.literalLength > 0) {
+        buffer.Append(Fmt::Get() + piece.literalBegin, piece.literalLength);
+    }
+    if constexpr (piece.argIndex >= 0) {
+        using Arg = std::decay_t<std::tuple_element_t<piece.argIndex, Tuple>>;
+        WriteArg<piece.kind, piece.precision, Arg>(buffer, std::get<piece.argIndex>(args));
+    }
+}
+
+template <typename Fmt, typename Tuple, size_t... I>
+void WritePieces(FormatBuffer& buffer, const Tuple& args, std::index_sequence<I...>) {
+    (WritePiece<Fmt, I>(buffer, args), ...);
+}
+
+} // namespace FixedFormatDetail
+
+// buffer 뒤에 이어 씀
+template <typename Fmt, typename... Args>
+void FormatTo(FormatBuffer& buffer, Fmt, const Args&... args) {
+    using Parsed = FixedFormatDetail::Parsed<Fmt>;
+    static_assert(Parsed::value.argCount == (int)sizeof...(Args),
+                  "형식 문자열의 {} 개수와 인자 수가 다릅니다");
+    // 인자는 참조로만 묶음 (std::string도 복사하지 않음)
+    FixedFormatDetail::WritePieces<Fmt>(buffer, std::forward_as_tuple(args...),
+                                        std::make_index_sequence<Parsed::kPieceCount>());
+}
+
+// char 배열에 처음부터 씀. 쓴 길이를 돌려줌 (잘렸으면 N - 1)
+template <size_t N, typename Fmt, typename... Args>
+size_t FormatTo(char (&out)[N], Fmt fmt, const Args&... args) {
+    static_assert(N > 0, "버퍼 크기는 1 이상이어야 합니다");
+    FormatBuffer buffer(out, N);
+    FormatTo(buffer, fmt, args...);
+    return buffer.Length();
+}
+
+// 크기가 고정된 스택 문자열 (항상 '\0'으로 끝남)
+template <size_t N>
+class FixedString {
+public:
+    static_assert(N > 0, "FixedString 크기는 1 이상이어야 합니다");
+
+    FixedString() { m_Data[0] = '\0'; }
+
+    template <typename Fmt, typename... Args>
+    FixedString& Append(Fmt fmt, const Args&... args) {
+        FormatBuffer buffer(m_Data, N, m_Length);
+        FormatTo(buffer, fmt, args...);
+        m_Length = buffer.Length();
+        m_Truncated = m_Truncated || buffer.IsTruncated();
+        return *this;
+    }
+
+    void Clear() {
+        m_Length = 0;
+        m_Truncated = false;
+        m_Data[0] = '\0';
+    }
+
+    const char* c_str() const { return m_Data; }
+    size_t Length() const { return m_Length; }
+    static constexpr size_t Capacity() { return N - 1; }
+    bool IsTruncated() const { return m_Truncated; }
+
+private:
+    char   m_Data[N];
+    size_t m_Length = 0;
+    bool   m_Truncated = false;
+};
+
+// 새 FixedString<N>에 씀
+template <size_t N, typename Fmt, typename... Args>
+FixedString<N> Format(Fmt fmt, const Args&... args) {
+    FixedString<N> result;
+    result.Append(fmt, args...);
+    return result;
+}
@@ -0,0 +1,178 @@
+/*============================================================================
+ *  SafeFilename.cpp - 니블 표 분류 커널 (Scalar / SSE4.1 / AVX2)
+ *============================================================================*/
+#include "SafeFilename.h"
+#include "SimdDispatch.h"
+
+#include <cstring>
+#include <cwchar>
+
+namespace SafeFilename {
+
+namespace {
+
+// 하위 니블 → 짝이 되는 상위 니블 비트 (2:bit0, 3:bit1, 5:bit2, 7:bit3)
+#define SAFE_FILENAME_LO_TABLE 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 3, 0, 14, 0, 2, 3
+#define SAFE_FILENAME_HI_TABLE 0, 0, 1, 2, 0, 4, 0, 8, 0, 0, 0, 0, 0, 0, 0, 0
+
+template <typename Unit>
+void ReplaceScalar(Unit* dst, const Unit* src, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        Unit c = src[i];
+        dst[i] = IsForbidden((uint32_t)c) ? (Unit)'_' : c;
+    }
+}
+
+// ----------------------------------------------------------------------------
+// SSE4.1
+// ----------------------------------------------------------------------------
+SIMD_TARGET_SSE41 inline __m128i ForbiddenMaskSSE(__m128i bytes) {
+    const __m128i loTable = _mm_setr_epi8(SAFE_FILENAME_LO_TABLE);
+    const __m128i hiTable = _mm_setr_epi8(SAFE_FILENAME_HI_TABLE);
+    const __m128i nibble = _mm_set1_epi8(0x0F);
+    __m128i lo = _mm_shuffle_epi8(loTable, _mm_and_si128(bytes, nibble));
+    __m128i hi = _mm_shuffle_epi8(hiTable, _mm_and_si128(_mm_srli_epi16(bytes, 4), nibble));
+    return _mm_cmpgt_epi8(_mm_and_si128(lo, hi), _mm_setzero_si128());
+}
+
+SIMD_TARGET_SSE41 inline void Replace8BlockSSE(char* dst, const char* src) {
+    __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+    __m128i r = _mm_blendv_epi8(v, _mm_set1_epi8('_'), ForbiddenMaskSSE(v));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), r);
+}
+
+SIMD_TARGET_SSE41 void Replace8SSE(char* dst, const char* src, size_t count) {
+    if (count < 16) {
+        ReplaceScalar(dst, src, count);
+        return;
+    }
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) Replace8BlockSSE(dst + i, src + i);
+    // 꼬리는 마지막 16글자를 다시 처리 (치환은 두 번 해도 같음)
+    if (i < count) Replace8BlockSSE(dst + count - 16, src + count - 16);
+}
+
+template <typename Unit>
+SIMD_TARGET_SSE41 inline void Replace16BlockSSE(Unit* dst, const Unit* src) {
+    __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+    __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 8));
+    __m128i mask = ForbiddenMaskSSE(_mm_packus_epi16(a, b));
+    const __m128i underscore = _mm_set1_epi16('_');
+    a = _mm_blendv_epi8(a, underscore, _mm_unpacklo_epi8(mask, mask));
+    b = _mm_blendv_epi8(b, underscore, _mm_unpackhi_epi8(mask, mask));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), a);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 8), b);
+}
+
+template <typename Unit>
+SIMD_TARGET_SSE41 void Replace16SSE(Unit* dst, const Unit* src, size_t count) {
+    if (count < 16) {
+        ReplaceScalar(dst, src, count);
+        return;
+    }
+    size_t i = 0;
+    for (; i + 16 <= count; i += 16) Replace16BlockSSE(dst + i, src + i);
+    if (i < count) Replace16BlockSSE(dst + count - 16, src + count - 16);
+}
+
+// ----------------------------------------------------------------------------
+// AVX2
+// ----------------------------------------------------------------------------
+SIMD_TARGET_AVX2 inline __m256i ForbiddenMaskAVX2(__m256i bytes) {
+    const __m256i loTable = _mm256_setr_epi8(SAFE_FILENAME_LO_TABLE, SAFE_FILENAME_LO_TABLE);
+    const __m256i hiTable = _mm256_setr_epi8(SAFE_FILENAME_HI_TABLE, SAFE_FILENAME_HI_TABLE);
+    const __m256i nibble = _mm256_set1_epi8(0x0F);
+    __m256i lo = _mm256_shuffle_epi8(loTable, _mm256_and_si256(bytes, nibble));
+    __m256i hi = _mm256_shuffle_epi8(hiTable, _mm256_and_si256(_mm256_srli_epi16(bytes, 4), nibble));
+    return _mm256_cmpgt_epi8(_mm256_and_si256(lo, hi), _mm256_setzero_si256());
+}
+
+SIMD_TARGET_AVX2 inline void Replace8BlockAVX2(char* dst, const char* src) {
+    __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src));
+    __m256i r = _mm256_blendv_epi8(v, _mm256_set1_epi8('_'), ForbiddenMaskAVX2(v));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), r);
+}
+
+SIMD_TARGET_AVX2 void Replace8AVX2(char* dst, const char* src, size_t count) {
+    if (count < 32) {
+        Replace8SSE(dst, src, count);
+        return;
+    }
+    size_t i = 0;
+    for (; i + 32 <= count; i += 32) Replace8BlockAVX2(dst + i, src + i);
+    if (i < count) Replace8BlockAVX2(dst + count - 32, src + count - 32);
+}
+
+// packus와 unpack은 둘 다 128비트 레인 단위라 서로 상쇄됨: a의 마스크는 unpacklo, b는 unpackhi
+template <typename Unit>
+SIMD_TARGET_AVX2 inline void Replace16BlockAVX2(Unit* dst, const Unit* src) {
+    __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src));
+    __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + 16));
+    __m256i mask = ForbiddenMaskAVX2(_mm256_packus_epi16(a, b));
+    const __m256i underscore = _mm256_set1_epi16('_');
+    a = _mm256_blendv_epi8(a, underscore, _mm256_unpacklo_epi8(mask, mask));
+    b = _mm256_blendv_epi8(b, underscore, _mm256_unpackhi_epi8(mask, mask));
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), a);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + 16), b);
+}
+
+template <typename Unit>
+SIMD_TARGET_AVX2 void Replace16AVX2(Unit* dst, const Unit* src, size_t count) {
+    if (count < 32) {
+        Replace16SSE(dst, src, count);
+        return;
+    }
+    size_t i = 0;
+    for (; i + 32 <= count; i += 32) Replace16BlockAVX2(dst + i, src + i);
+    if (i < count) Replace16BlockAVX2(dst + count - 32, src + count - 32);
+}
+
+#undef SAFE_FILENAME_LO_TABLE
+#undef SAFE_FILENAME_HI_TABLE
+
+template <typename Unit>
+void Replace16(Unit* dst, const Unit* src, size_t count) {
+    static_assert(sizeof(Unit) == 2, "16비트 문자 전용");
+    switch (GetSimdLevel()) {
+    case SimdLevel::AVX2:  Replace16AVX2(dst, src, count); break;
+    case SimdLevel::SSE41: Replace16SSE(dst, src, count); break;
+    default:               ReplaceScalar(dst, src, count); break;
+    }
+}
+
+} // namespace
+
+void Replace(char* dst, const char* src, size_t count) {
+    switch (GetSimdLevel()) {
+    case SimdLevel::AVX2:  Replace8AVX2(dst, src, count); break;
+    case SimdLevel::SSE41: Replace8SSE(dst, src, count); break;
+    default:               ReplaceScalar(dst, src, count); break;
+    }
+}
+
+void Replace(char16_t* dst, const char16_t* src, size_t count) {
+    Replace16(dst, src, count);
+}
+
+size_t Copy(char* dst, size_t dstSize, const char* src) {
+    if (dstSize == 0) return 0;
+    size_t length = strnlen(src, dstSize - 1);
+    Replace(dst, src, length);
+    dst[length] = '\0';
+    return length;
+}
+
+size_t Copy(wchar_t* dst, size_t dstSize, const wchar_t* src) {
+    if (dstSize == 0) return 0;
+    size_t length = wcsnlen(src, dstSize - 1);
+    // Windows의 wchar_t는 UTF-16 (2바이트). 4바이트인 플랫폼은 스칼라로 처리
+    if constexpr (sizeof(wchar_t) == 2) {
+        Replace16(dst, src, length);
+    } else {
+        ReplaceScalar(dst, src, length);
+    }
+    dst[length] = L'\0';
+    return length;
+}
+
+} // namespace SafeFilename
@@ -0,0 +1,46 @@
+/*============================================================================
+ *  SafeFilename - 파일명 금지 문자(/ \ : * ? " < > |)를 '_'로 치환 (SIMD)
+ *  ---------------------------------------------------------------------------
+ *  브랜치명·경로를 덤프/로그 파일명으로 쓰려면 금지 문자를 바꿔야 합니다.
+ *  글자마다 9번 비교하는 루프 대신, 16/32글자를 한 번에 분류합니다.
+ *
+ *  분류는 니블 표 두 개로 합니다 (pshufb).
+ *      금지 문자    상위 니블  하위 니블
+ *      " * /          2        2 A F
+ *      : < > ?        3        A C E F
+ *      \              5        C
+ *      |              7        C
+ *  상위 니블 표는 2/3/5/7에 비트 하나씩, 하위 니블 표는 그 니블과 짝이 되는
+ *  상위 니블의 비트들을 담습니다. 두 표 값의 AND가 0이 아니면 금지 문자입니다.
+ *  16비트 문자는 두 벡터를 바이트로 포화 축소해서(0x100 이상 → 0xFF/0x00, 금지 아님)
+ *  같은 표로 분류합니다.
+ *
+ *  Copy는 기존 MakeSafeFilename과 같은 규칙입니다: dstSize - 1글자까지 옮기고
+ *  항상 '\0'으로 끝냅니다 (dstSize가 0이면 아무것도 쓰지 않음).
+ *============================================================================*/
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace SafeFilename {
+
+inline bool IsForbidden(uint32_t c) {
+    switch (c) {
+    case '/': case '\\': case ':': case '*': case '?':
+    case '"': case '<': case '>': case '|':
+        return true;
+    default:
+        return false;
+    }
+}
+
+// count글자를 치환해서 dst에 씀 (dst == src면 제자리 치환)
+void Replace(char* dst, const char* src, size_t count);
+void Replace(char16_t* dst, const char16_t* src, size_t count);
+
+// '\0'으로 끝나는 src를 치환 복사. 쓴 글자 수('\0' 제외)를 돌려줌
+size_t Copy(char* dst, size_t dstSize, const char* src);
+size_t Copy(wchar_t* dst, size_t dstSize, const wchar_t* src);
+
+} // namespace SafeFilename
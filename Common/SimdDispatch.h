@@ -0,0 +1,115 @@
+/*============================================================================
+ *  SimdDispatch - 실행 중 CPU 기능 검사로 SIMD 커널 선택
+ *  ---------------------------------------------------------------------------
+ *  같은 실행 파일이 AVX2가 없는 PC에서도 돌아야 하므로
+ *  컴파일 옵션(/arch:AVX2)으로 고정하지 않고, 실행 시 CPUID로 검사해서
+ *  Scalar / SSE4.1 / AVX2 커널 중 하나를 고릅니다.
+ *
+ *  MSVC는 /arch 옵션 없이도 모든 intrinsic을 쓸 수 있으므로 SIMD_TARGET_*는 비어 있고,
+ *  GCC/Clang에서는 함수 단위 target 속성으로 해당 명령어 사용을 허용합니다.
+ *
+ *  SetSimdLevel()로 낮은 단계를 강제할 수 있습니다 (벤치마크/검증용).
+ *============================================================================*/
+#pragma once
+
+#include <cstdint>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#include <immintrin.h>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#define SIMD_TARGET_SSE41
+#define SIMD_TARGET_AVX2
+#else
+#define SIMD_TARGET_SSE41 __attribute__((target("sse4.1")))
+// fma는 일부러 켜지 않음: GCC가 mul + add를 FMA로 합쳐서 Scalar와 결과가 달라짐
+#define SIMD_TARGET_AVX2  __attribute__((target("avx2")))
+#endif
+
+enum class SimdLevel {
+    Scalar,
+    SSE41,
+    AVX2,
+};
+
+inline const char* GetSimdLevelName(SimdLevel level) {
+    switch (level) {
+    case SimdLevel::SSE41: return "SSE4.1";
+    case SimdLevel::AVX2:  return "AVX2";
+    default:               return "Scalar";
+    }
+}
+
+namespace SimdDetail {
+
+inline void CpuId(int leaf, int subLeaf, int regs[4]) {
+#if defined(_MSC_VER)
+    __cpuidex(regs, leaf, subLeaf);
+#else
+    unsigned int a = 0, b = 0, c = 0, d = 0;
+    __cpuid_count(leaf, subLeaf, a, b, c, d);
+    regs[0] = (int)a; regs[1] = (int)b; regs[2] = (int)c; regs[3] = (int)d;
+#endif
+}
+
+inline uint64_t ReadXcr0() {
+#if defined(_MSC_VER)
+    return _xgetbv(0);
+#else
+    uint32_t lo = 0, hi = 0;
+    __asm__ volatile("xgetbv" : "=a"(lo), "=d"(hi) : "c"(0));
+    return ((uint64_t)hi << 32) | lo;
+#endif
+}
+
+inline SimdLevel DetectSimdLevel() {
+    int regs[4];
+    CpuId(0, 0, regs);
+    int maxLeaf = regs[0];
+
+    CpuId(1, 0, regs);
+    bool sse41   = (regs[2] & (1 << 19)) != 0;
+    bool osxsave = (regs[2] & (1 << 27)) != 0;
+    bool avx     = (regs[2] & (1 << 28)) != 0;
+
+    // AVX 레지스터(YMM) 저장을 OS가 지원하는지 확인 (XCR0 bit 1, 2)
+    bool osAvx = osxsave && (ReadXcr0() & 0x6) == 0x6;
+
+    bool avx2 = false;
+    if (maxLeaf >= 7) {
+        CpuId(7, 0, regs);
+        avx2 = (regs[1] & (1 << 5)) != 0;
+    }
+
+    if (avx && avx2 && osAvx) return SimdLevel::AVX2;
+    if (sse41) return SimdLevel::SSE41;
+    return SimdLevel::Scalar;
+}
+
+inline SimdLevel& ActiveLevel() {
+    static SimdLevel s_Level = DetectSimdLevel();
+    return s_Level;
+}
+
+} // namespace SimdDetail
+
+// 이 CPU가 지원하는 최고 단계
+inline SimdLevel GetSupportedSimdLevel() {
+    static const SimdLevel s_Supported = SimdDetail::DetectSimdLevel();
+    return s_Supported;
+}
+
+// 현재 커널 선택에 쓰이는 단계
+inline SimdLevel GetSimdLevel() {
+    return SimdDetail::ActiveLevel();
+}
+
+// 지원 범위 안에서만 변경됨 (AVX2가 없는 CPU에서 AVX2를 강제할 수 없음)
+inline void SetSimdLevel(SimdLevel level) {
+    if (level > GetSupportedSimdLevel()) level = GetSupportedSimdLevel();
+    SimdDetail::ActiveLevel() = level;
+}